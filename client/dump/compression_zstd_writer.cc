@@ -0,0 +1,127 @@
+/*
+  Copyright (c) 2021, Percona and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+*/
+
+#include "client/dump/compression_zstd_writer.h"
+
+#include <functional>
+
+using namespace Mysql::Tools::Dump;
+
+bool Compression_zstd_writer::process_result(size_t zstd_result,
+                                             ZSTD_outBuffer *output) {
+  if (ZSTD_isError(zstd_result)) {
+    this->pass_message(Mysql::Tools::Base::Message_data(
+        0,
+        std::string("zstd compression failed: ") +
+            ZSTD_getErrorName(zstd_result),
+        Mysql::Tools::Base::Message_type_error));
+    return true;
+  }
+  if (output->pos > 0) {
+    this->append_output(std::string(&m_buffer[0], output->pos));
+    output->pos = 0;
+  }
+  return false;
+}
+
+void Compression_zstd_writer::append(const std::string &data_to_append) {
+  std::lock_guard<std::mutex> lock(m_zstd_mutex);
+  ZSTD_inBuffer input = {data_to_append.data(), data_to_append.size(), 0};
+  ZSTD_outBuffer output = {&m_buffer[0], m_buffer.size(), 0};
+
+  while (input.pos < input.size) {
+#if ZSTD_VERSION_NUMBER < 10400
+    size_t res = ZSTD_compressStream(m_compression_context, &output, &input);
+#else
+    size_t res = ZSTD_compressStream2(m_compression_context, &output, &input,
+                                      ZSTD_e_continue);
+#endif
+    if (this->process_result(res, &output)) return;
+  }
+}
+
+Compression_zstd_writer::~Compression_zstd_writer() {
+  std::lock_guard<std::mutex> lock(m_zstd_mutex);
+  if (m_compression_context == nullptr) return;
+
+  ZSTD_outBuffer output = {&m_buffer[0], m_buffer.size(), 0};
+  size_t remaining;
+  do {
+#if ZSTD_VERSION_NUMBER < 10400
+    remaining = ZSTD_endStream(m_compression_context, &output);
+#else
+    ZSTD_inBuffer input = {nullptr, 0, 0};
+    remaining = ZSTD_compressStream2(m_compression_context, &output, &input,
+                                     ZSTD_e_end);
+#endif
+    if (this->process_result(remaining, &output)) break;
+  } while (remaining > 0);
+
+  ZSTD_freeCStream(m_compression_context);
+}
+
+Compression_zstd_writer::Compression_zstd_writer(
+    std::function<bool(const Mysql::Tools::Base::Message_data &)>
+        *message_handler,
+    Simple_id_generator *object_id_generator, int compression_level,
+    uint worker_threads)
+    : Abstract_output_writer_wrapper(message_handler, object_id_generator),
+      m_compression_context(nullptr),
+      m_compression_level(compression_level),
+      m_worker_threads(worker_threads) {}
+
+bool Compression_zstd_writer::init() {
+  m_compression_context = ZSTD_createCStream();
+  if (m_compression_context == nullptr) {
+    this->pass_message(Mysql::Tools::Base::Message_data(
+        0, "zstd compression initialization failed",
+        Mysql::Tools::Base::Message_type_error));
+    return true;
+  }
+
+#if ZSTD_VERSION_NUMBER < 10400
+  size_t res = ZSTD_initCStream(m_compression_context, m_compression_level);
+#else
+  size_t res = ZSTD_CCtx_setParameter(
+      m_compression_context, ZSTD_c_compressionLevel, m_compression_level);
+  /*
+    Worker threads are only available when libzstd was built with
+    ZSTD_MULTITHREAD; otherwise compress in the calling thread.
+  */
+  if (!ZSTD_isError(res) && m_worker_threads > 1)
+    ZSTD_CCtx_setParameter(m_compression_context, ZSTD_c_nbWorkers,
+                           static_cast<int>(m_worker_threads));
+#endif
+  if (ZSTD_isError(res)) {
+    this->pass_message(Mysql::Tools::Base::Message_data(
+        0, "zstd compression initialization failed",
+        Mysql::Tools::Base::Message_type_error));
+    ZSTD_freeCStream(m_compression_context);
+    m_compression_context = nullptr;
+    return true;
+  }
+
+  m_buffer.resize(ZSTD_CStreamOutSize());
+  return false;
+}
@@ -287,7 +287,8 @@ void Mysqldump_tool_chain_maker_options::create_options() {
       "Direct all output generated for all objects to a given file.");
   this->create_new_option(
       &m_compress_output_algorithm, "compress-output",
-      "Compresses all output files with LZ4 or ZLIB compression algorithm.");
+      "Compresses all output files with LZ4, ZLIB or ZSTD compression "
+      "algorithm.");
   this->create_new_option(&m_skip_rows_data, "skip-dump-rows",
                           "Skip dumping rows of all tables to output.")
       ->set_short_character('d');
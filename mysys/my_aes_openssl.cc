@@ -113,26 +113,86 @@ static const EVP_CIPHER *aes_evp_type(const my_aes_opmode mode) {
   }
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+namespace {
+/**
+  Cipher context kept for the lifetime of a thread, so that my_aes_encrypt()
+  and my_aes_decrypt() do not allocate and free one for every call.
+
+  EVP_CIPHER_CTX_reset() and EVP_CipherInit_ex() with a cipher free the
+  cipher data of the context, so the context is only re-keyed as long as
+  the cipher stays the same, which reuses the cipher data allocated for it.
+*/
+class Thread_cipher_ctx {
+ public:
+  ~Thread_cipher_ctx() { EVP_CIPHER_CTX_free(m_ctx); }
+
+  /**
+    Set up the context for one encryption or decryption.
+
+    @param cipher  the cipher
+    @param key     the key
+    @param iv      the initialization vector, can be nullptr
+    @param enc     1 to encrypt, 0 to decrypt
+
+    @return the context, nullptr on error
+  */
+  EVP_CIPHER_CTX *init(const EVP_CIPHER *cipher, const unsigned char *key,
+                       const unsigned char *iv, int enc) {
+    if (m_ctx == nullptr && (m_ctx = EVP_CIPHER_CTX_new()) == nullptr)
+      return nullptr;
+
+    if (!EVP_CipherInit_ex(m_ctx, cipher == m_cipher ? nullptr : cipher,
+                           nullptr, key, iv, enc)) {
+      reset();
+      return nullptr;
+    }
+    m_cipher = cipher;
+    return m_ctx;
+  }
+
+  /** Release the cipher data, after an error */
+  void reset() {
+    EVP_CIPHER_CTX_reset(m_ctx);
+    m_cipher = nullptr;
+  }
+
+ private:
+  EVP_CIPHER_CTX *m_ctx{nullptr};
+  /** The cipher m_ctx is set up for */
+  const EVP_CIPHER *m_cipher{nullptr};
+};
+
+thread_local Thread_cipher_ctx thread_cipher_ctx;
+}  // namespace
+#endif /* OPENSSL_VERSION_NUMBER >= 0x10100000L */
+
 int my_aes_encrypt(const unsigned char *source, uint32 source_length,
                    unsigned char *dest, const unsigned char *key,
                    uint32 key_length, enum my_aes_opmode mode,
                    const unsigned char *iv, bool padding) {
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX stack_ctx;
-  EVP_CIPHER_CTX *ctx = &stack_ctx;
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
   /* The real key to be used for encryption */
   unsigned char rkey[MAX_AES_KEY_LENGTH / 8];
-  my_aes_create_key(key, key_length, rkey, mode);
 
-  if (!ctx || !cipher || (EVP_CIPHER_iv_length(cipher) > 0 && !iv))
+  if (!cipher || (EVP_CIPHER_iv_length(cipher) > 0 && !iv))
     return MY_AES_BAD_DATA;
 
-  if (!EVP_EncryptInit(ctx, cipher, rkey, iv)) goto aes_error;   /* Error */
+  my_aes_create_key(key, key_length, rkey, mode);
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+  EVP_CIPHER_CTX stack_ctx;
+  EVP_CIPHER_CTX *ctx = &stack_ctx;
+  EVP_CIPHER_CTX_init(ctx);
+  if (!EVP_EncryptInit(ctx, cipher, rkey, iv)) goto aes_error; /* Error */
+#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.init(cipher, rkey, iv, 1);
+  if (!ctx) goto aes_error; /* Error */
+#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  /* The key schedule is in the context now */
+  OPENSSL_cleanse(rkey, sizeof(rkey));
+
   if (!EVP_CIPHER_CTX_set_padding(ctx, padding)) goto aes_error; /* Error */
   if (!EVP_EncryptUpdate(ctx, dest, &u_len, source, source_length))
     goto aes_error; /* Error */
@@ -141,18 +201,17 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
 
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return u_len + f_len;
 
 aes_error:
   /* need to explicitly clean up the error if we want to ignore it */
   ERR_clear_error();
+  OPENSSL_cleanse(rkey, sizeof(rkey));
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  thread_cipher_ctx.reset();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
@@ -161,24 +220,29 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
                    unsigned char *dest, const unsigned char *key,
                    uint32 key_length, enum my_aes_opmode mode,
                    const unsigned char *iv, bool padding) {
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX stack_ctx;
-  EVP_CIPHER_CTX *ctx = &stack_ctx;
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
 
   /* The real key to be used for decryption */
   unsigned char rkey[MAX_AES_KEY_LENGTH / 8];
 
-  my_aes_create_key(key, key_length, rkey, mode);
-  if (!ctx || !cipher || (EVP_CIPHER_iv_length(cipher) > 0 && !iv))
+  if (!cipher || (EVP_CIPHER_iv_length(cipher) > 0 && !iv))
     return MY_AES_BAD_DATA;
 
-  if (!EVP_DecryptInit(ctx, aes_evp_type(mode), rkey, iv))
-    goto aes_error;                                              /* Error */
+  my_aes_create_key(key, key_length, rkey, mode);
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+  EVP_CIPHER_CTX stack_ctx;
+  EVP_CIPHER_CTX *ctx = &stack_ctx;
+  EVP_CIPHER_CTX_init(ctx);
+  if (!EVP_DecryptInit(ctx, cipher, rkey, iv)) goto aes_error; /* Error */
+#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.init(cipher, rkey, iv, 0);
+  if (!ctx) goto aes_error; /* Error */
+#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  /* The key schedule is in the context now */
+  OPENSSL_cleanse(rkey, sizeof(rkey));
+
   if (!EVP_CIPHER_CTX_set_padding(ctx, padding)) goto aes_error; /* Error */
   if (!EVP_DecryptUpdate(ctx, dest, &u_len, source, source_length))
     goto aes_error; /* Error */
@@ -187,8 +251,6 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
 
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
 
   return u_len + f_len;
@@ -196,10 +258,11 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
 aes_error:
   /* need to explicitly clean up the error if we want to ignore it */
   ERR_clear_error();
+  OPENSSL_cleanse(rkey, sizeof(rkey));
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  thread_cipher_ctx.reset();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
@@ -86,6 +86,7 @@ static char *gen_rnd_email(UDF_INIT *initid, UDF_ARGS *args,
                           .append("@")
                           .append(email_domain);
   *length = email.size();
+  delete[] initid->ptr;
   initid->ptr = new char[*length + 1];
   strcpy(initid->ptr, email.c_str());
   *is_error = 0;
@@ -62,6 +62,7 @@ static char *gen_rnd_pan(UDF_INIT *initid,
 
   std::string pan = mysql::plugins::random_credit_card();
   *length = pan.size();
+  delete[] initid->ptr;
   initid->ptr = new char[*length + 1];
   strcpy(initid->ptr, pan.c_str());
   *is_null = 0;
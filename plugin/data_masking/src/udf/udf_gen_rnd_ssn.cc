@@ -63,6 +63,7 @@ static char *gen_rnd_ssn(UDF_INIT *initid,
 
   std::string ssn = mysql::plugins::random_ssn();
   *length = ssn.size();
+  delete[] initid->ptr;
   initid->ptr = new char[*length + 1];
   strcpy(initid->ptr, ssn.c_str());
 
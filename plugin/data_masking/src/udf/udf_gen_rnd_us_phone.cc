@@ -67,6 +67,7 @@ static char *gen_rnd_us_phone(UDF_INIT *initid,
 
   std::string phone = mysql::plugins::random_us_phone();
   *length = phone.size();
+  delete[] initid->ptr;
   initid->ptr = new char[*length + 1];
   strcpy(initid->ptr, phone.c_str());
   *is_error = 0;
@@ -94,6 +94,7 @@ static const char *mask_outer(UDF_INIT *initid, UDF_ARGS *args,
         args->args[0], args->lengths[0], *(int *)args->args[1],
         *(int *)args->args[2], masking_char);
     if ((*length = s.length()) > 0) {
+      delete[] initid->ptr;
       initid->ptr = new char[*length + 1];
       strcpy(initid->ptr, s.c_str());
     }
@@ -86,6 +86,7 @@ static const char *mask_pan_relaxed(UDF_INIT *initid, UDF_ARGS *args,
                                      unmasked_chars_start, unmasked_chars_end,
                                      masking_char);
     *length = s.length();
+    delete[] initid->ptr;
     initid->ptr = new char[*length + 1];
     strcpy(initid->ptr, s.c_str());
   }
@@ -80,6 +80,7 @@ static const char *mask_ssn(UDF_INIT *initid, UDF_ARGS *args,
     s = mysql::plugins::mask_inner(args->args[0], args->lengths[0], 0,
                                    unmasked_chars_end, masking_char);
     *length = s.length();
+    delete[] initid->ptr;
     initid->ptr = new char[*length + 1];
     strcpy(initid->ptr, s.c_str());
     initid->ptr[3] = '-';
@@ -20,63 +20,51 @@
 
 namespace mysql {
 namespace plugins {
+
+/**
+ * Returns the calling thread's random engine. Seeding from std::random_device
+ * costs a system call, so it is done once per thread instead of per value.
+ */
+static std::default_random_engine &random_engine() {
+  thread_local std::default_random_engine engine{std::random_device{}()};
+  return engine;
+}
+
 std::string random_string(unsigned long length, bool letter_start) {
-  auto randchar_a = []() -> char {
-    const std::string charset(
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz");
-    std::random_device r;
-    std::default_random_engine el(r());
-    std::uniform_int_distribution<int> dist(0, charset.length() - 1);
-
-    return charset[dist(el)];
-  };
-  auto randchar_an = []() -> char {
-    const std::string charset(
-        "0123456789"
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz");
-    std::random_device r;
-    std::default_random_engine el(r());
-    std::uniform_int_distribution<int> dist(0, charset.length() - 1);
-
-    return charset[dist(el)];
-  };
+  static const char charset[] =
+      "0123456789"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "abcdefghijklmnopqrstuvwxyz";
+  // Letters only: skip the leading digits of charset
+  std::uniform_int_distribution<int> dist_a(10, sizeof(charset) - 2);
+  std::uniform_int_distribution<int> dist_an(0, sizeof(charset) - 2);
+  auto &engine = random_engine();
 
   std::string str(length, '0');
-  if (letter_start) {
-    std::string::iterator it = str.begin();
-    std::generate_n(it++, 1, randchar_a);
-    std::generate_n(it, length - 1, randchar_an);
-  } else {
-    std::generate_n(str.begin(), length, randchar_an);
+  for (unsigned long i = 0; i < length; i++) {
+    str[i] = charset[(i == 0 && letter_start) ? dist_a(engine)
+                                              : dist_an(engine)];
   }
 
   return str;
 }
 
 std::string random_number(const unsigned int length) {
-  auto randchar = []() -> char {
-    const std::string charset("1234567890");
-    std::random_device r;
-    std::default_random_engine el(r());
-    std::uniform_int_distribution<int> dist(0, charset.length() - 1);
-
-    return charset[dist(el)];
-  };
+  std::uniform_int_distribution<int> dist(0, 9);
+  auto &engine = random_engine();
 
   std::string str(length, '0');
-  std::generate_n(str.begin(), length, randchar);
+  for (unsigned int i = 0; i < length; i++) {
+    str[i] = static_cast<char>('0' + dist(engine));
+  }
 
   return str;
 }
 
 long random_number(const long min, const long max) {
-  std::random_device r;
-  std::default_random_engine el(r());
   std::uniform_int_distribution<long> dist(min, max);
 
-  return dist(el);
+  return dist(random_engine());
 }
 
 // Validate: https://stevemorse.org/ssn/cc.html
@@ -1132,10 +1132,27 @@ void Certifier::garbage_collect() {
     the certification info.
   */
   Certification_info::iterator it = certification_info.begin();
+  /*
+    All write set items of a transaction share the same snapshot version,
+    so compare each Gtid_set_ref against the stable set only once.
+  */
+  std::unordered_map<const Gtid_set_ref *, bool> stable_refs;
   stable_gtid_set_lock->wrlock();
   while (it != certification_info.end()) {
-    if (it->second->is_subset_not_equals(stable_gtid_set)) {
-      if (it->second->unlink() == 0) delete it->second;
+    Gtid_set_ref *snapshot_version = it->second;
+    auto stable_it = stable_refs.find(snapshot_version);
+    if (stable_it == stable_refs.end())
+      stable_it =
+          stable_refs
+              .emplace(snapshot_version,
+                       snapshot_version->is_subset_not_equals(stable_gtid_set))
+              .first;
+
+    if (stable_it->second) {
+      if (snapshot_version->unlink() == 0) {
+        stable_refs.erase(stable_it);
+        delete snapshot_version;
+      }
       certification_info.erase(it++);
     } else
       ++it;
@@ -29,6 +29,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <atomic>
+#include <memory>
 #include <new>
 
 #include <mysql/components/my_service.h>
@@ -37,6 +38,7 @@
 #include "my_inttypes.h"
 #include "my_psi_config.h"
 #include "my_sys.h"
+#include "mysql/psi/mysql_mutex.h"
 #include "mysql/psi/mysql_rwlock.h"
 #include "mysqld_error.h"
 #include "plugin/rewriter/rewriter.h"
@@ -70,7 +72,10 @@ static const size_t MAX_QUERY_LENGTH_IN_LOG = 100;
 
 static MYSQL_PLUGIN plugin_info;
 
+/// Protects the rewriter pointer, held in read mode while rewriting.
 static mysql_rwlock_t LOCK_table;
+/// Serializes reloads, which build the new rules table without LOCK_table.
+static mysql_mutex_t LOCK_reload;
 static Rewriter *rewriter;
 
 /// @name Status variables for the plugin.
@@ -202,12 +207,21 @@ static PSI_rwlock_info all_rewrite_rwlocks[] = {{&key_rwlock_LOCK_table_,
                                                  "LOCK_plugin_rewriter_table_",
                                                  0, 0, PSI_DOCUMENT_ME}};
 
+PSI_mutex_key key_mutex_LOCK_reload_;
+
+static PSI_mutex_info all_rewrite_mutexes[] = {{&key_mutex_LOCK_reload_,
+                                                "LOCK_plugin_rewriter_reload_",
+                                                0, 0, PSI_DOCUMENT_ME}};
+
 static void init_rewriter_psi_keys() {
   const char *category = "rewriter";
   int count;
 
   count = static_cast<int>(array_elements(all_rewrite_rwlocks));
   mysql_rwlock_register(category, all_rewrite_rwlocks, count);
+
+  count = static_cast<int>(array_elements(all_rewrite_mutexes));
+  mysql_mutex_register(category, all_rewrite_mutexes, count);
 }
 #endif
 
@@ -216,6 +230,7 @@ static int rewriter_plugin_init(MYSQL_PLUGIN plugin_ref) {
   init_rewriter_psi_keys();
 #endif
   mysql_rwlock_init(key_rwlock_LOCK_table_, &LOCK_table);
+  mysql_mutex_init(key_mutex_LOCK_reload_, &LOCK_reload, MY_MUTEX_INIT_FAST);
   plugin_info = plugin_ref;
   status_var_number_rewritten_queries = 0;
   status_var_reload_error = false;
@@ -239,34 +254,52 @@ static int rewriter_plugin_deinit(void *) {
   plugin_info = nullptr;
   delete rewriter;
   mysql_rwlock_destroy(&LOCK_table);
+  mysql_mutex_destroy(&LOCK_reload);
   deinit_logging_service_for_plugin(&reg_srv, &log_bi, &log_bs);
   return 0;
 }
 
 /**
-  Reloads the rules into the in-memory table. This function assumes that the
-  appropriate lock is already taken and doesn't concern itself with locks.
+  Reloads the rules into a new in-memory table and installs it. The rules are
+  read and parsed without LOCK_table, so that queries keep being rewritten
+  with the old rules meanwhile; the write lock is only taken to swap the
+  tables. This function assumes that LOCK_reload is already taken.
 */
 static bool reload(MYSQL_THD thd) {
   longlong errcode = 0;
+  std::unique_ptr<Rewriter> new_rewriter;
   try {
-    errcode = rewriter->refresh(thd);
-    if (errcode == 0) return false;
+    new_rewriter.reset(new Rewriter());
+    errcode = new_rewriter->refresh(thd);
   } catch (const std::bad_alloc &) {
     errcode = ER_REWRITER_OOM;
+    new_rewriter.reset();
   }
-  DBUG_ASSERT(errcode != 0);
+
+  /*
+    If the rules table is malformed, or we ran out of memory while loading,
+    the rules loaded so far stay in place.
+  */
+  if (new_rewriter && errcode != ER_REWRITER_TABLE_MALFORMED_ERROR) {
+    mysql_rwlock_wrlock(&LOCK_table);
+    Rewriter *old_rewriter = rewriter;
+    rewriter = new_rewriter.release();
+    mysql_rwlock_unlock(&LOCK_table);
+    delete old_rewriter;
+  }
+
+  if (errcode == 0) return false;
   LogPluginErr(ERROR_LEVEL, errcode);
   return true;
 }
 
 static bool lock_and_reload(MYSQL_THD thd) {
-  mysql_rwlock_wrlock(&LOCK_table);
+  mysql_mutex_lock(&LOCK_reload);
   status_var_reload_error = reload(thd);
   status_var_number_loaded_rules = rewriter->get_number_loaded_rules();
   ++status_var_number_reloads;
   needs_initial_load = false;
-  mysql_rwlock_unlock(&LOCK_table);
+  mysql_mutex_unlock(&LOCK_reload);
 
   return status_var_reload_error;
 }
@@ -33,28 +33,29 @@ if [[ -n "$MYSQL_PASSWORD" ]]; then
     EXTRA_ARGS="$EXTRA_ARGS --password=${MYSQL_PASSWORD}"
 fi
 if [[ -r $DEFAULTS_EXTRA_FILE ]];then 
-    MYSQL_CMDLINE="mysql --defaults-extra-file=$DEFAULTS_EXTRA_FILE -nNE --connect-timeout=$TIMEOUT \
+    MYSQL_CMDLINE="mysql --defaults-extra-file=$DEFAULTS_EXTRA_FILE -nN --connect-timeout=$TIMEOUT \
                     ${EXTRA_ARGS}"
 else 
-    MYSQL_CMDLINE="mysql -nNE --connect-timeout=$TIMEOUT ${EXTRA_ARGS}"
+    MYSQL_CMDLINE="mysql -nN --connect-timeout=$TIMEOUT ${EXTRA_ARGS}"
 fi
 #
-# Perform the query to check the wsrep_local_state
+# Fetch wsrep_local_state, wsrep_cluster_status and read_only with a single
+# connection, so that every probe costs one login only.
 #
-WSREP_STATUS=($($MYSQL_CMDLINE -e "SHOW GLOBAL STATUS LIKE 'wsrep_%';"  \
-    2>${ERR_FILE} | grep -A 1 -E 'wsrep_local_state$|wsrep_cluster_status$' \
-    | sed -n -e '2p'  -e '5p' | tr '\n' ' '))
+WSREP_STATUS=($($MYSQL_CMDLINE -e "SHOW GLOBAL STATUS WHERE Variable_name \
+    IN ('wsrep_local_state', 'wsrep_cluster_status'); \
+    SELECT @@global.read_only;" 2>${ERR_FILE} | awk \
+    '$1 == "wsrep_local_state"    { state = $2 }
+     $1 == "wsrep_cluster_status" { status = $2 }
+     NF == 1                      { read_only = $1 }
+     END { print state, status, read_only }'))
  
 if [[ ${WSREP_STATUS[1]} == 'Primary' && ( ${WSREP_STATUS[0]} -eq 4 || \
     ( ${WSREP_STATUS[0]} -eq 2 && $AVAILABLE_WHEN_DONOR -eq 1 ) ) ]]
 then 
 
-    # Check only when set to 0 to avoid latency in response.
     if [[ $AVAILABLE_WHEN_READONLY -eq 0 ]];then
-        READ_ONLY=$($MYSQL_CMDLINE -e "SHOW GLOBAL VARIABLES LIKE 'read_only';" \
-                    2>${ERR_FILE} | tail -1 2>>${ERR_FILE})
-
-        if [[ "${READ_ONLY}" == "ON" ]];then 
+        if [[ ${WSREP_STATUS[2]} -eq 1 ]];then 
             # Percona XtraDB Cluster node local state is 'Synced', but it is in
             # read-only mode. The variable AVAILABLE_WHEN_READONLY is set to 0.
             # => return HTTP 503
@@ -0,0 +1,756 @@
+#!/bin/bash -ue
+
+# Copyright (C) 2020 Percona Inc
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; version 2 of the License.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING. If not, write to the
+# Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston
+# MA  02110-1301  USA.
+
+# This is a reference script for clone-plugin based state snapshot transfer
+#
+# Overview:
+#   The data is copied by the clone plugin (page level, multi-threaded),
+#   no external backup tool is involved.
+#
+#   JOINER: listens on the SST port for the donor handshake and starts a
+#           temporary (scratch) mysqld instance with the clone plugin.
+#   DONOR:  the server creates 'mysql.pxc.sst.clone'@'<joiner IP>'
+#           (BACKUP_ADMIN) with a password of its own and loads the clone
+#           plugin for the duration of the SST if it is not loaded yet.
+#           The IP is the one the host of the joiner's SST address
+#           (wsrep_sst_receive_address) resolves to on the donor, so the
+#           joiner must reach the donor's SQL port from that address.
+#           The script sends the donor address, the clone credentials
+#           and the size of its InnoDB data to the joiner, over SSL when
+#           encrypt=4.
+#   JOINER: removes the old data, checks the free space and the scratch
+#           instance runs CLONE INSTANCE FROM the donor into a directory
+#           inside the datadir, whose contents are then moved into place.
+#           The galera position is recovered from the cloned data with
+#           --wsrep-recover and reported to the server.
+#
+#  [sst] options used by this script:
+#     encrypt               : 4 to encrypt the handshake with SSL, implied by
+#                             pxc-encrypt-cluster-traffic (default 0)
+#     ssl-ca, ssl-cert, ssl-key, ssl-dhparams : SSL files for encrypt=4
+#                             (default: the [mysqld] ones)
+#     tmpdir                : parent of the scratch instance directory
+#                             (default: [mysqld] tmpdir, then the system one)
+#     clone-max-concurrency : clone_max_concurrency on the joiner (default 16)
+#
+#  The recipient instance shares the page size, the system tablespace, redo
+#  and undo settings, lower_case_table_names and the keyring plugin
+#  (keyring_file or keyring_vault) of the joiner's [mysqld] configuration.
+#     clone-ssl             : REQUIRE SSL/NO SSL for the clone connection
+#                             (default: let the clone plugin decide)
+#     sst-initial-timeout   : seconds the joiner waits for the donor (300)
+#     clone-progress-interval : seconds between clone progress reports in
+#                             the joiner's error log, 0 disables (60)
+
+OS=$(uname)
+[ "$OS" == "Darwin" ] && export -n LD_LIBRARY_PATH
+
+. $(dirname $0)/wsrep_sst_common
+
+readonly CLONE_USER="mysql.pxc.sst.clone"
+readonly CLONE_MODULE="clone_sst"
+
+wsrep_check_programs socat
+if [[ $? -ne 0 ]]; then
+    wsrep_log_error "******************* FATAL ERROR ********************** "
+    wsrep_log_error "socat not found in PATH! Make sure you have it installed."
+    wsrep_log_error "******************* FATAL ERROR ********************** "
+    exit 2 # ENOENT
+fi
+
+auto_upgrade=$(parse_cnf sst auto-upgrade "")
+auto_upgrade=$(normalize_boolean "$auto_upgrade" "on")
+
+force_upgrade=${WSREP_SST_OPT_FORCE_UPGRADE:-""}
+if [[ -z $force_upgrade ]]; then
+    force_upgrade=$(parse_cnf sst force-upgrade "")
+fi
+force_upgrade=$(normalize_boolean "$force_upgrade" "off")
+
+clone_max_concurrency=$(parse_cnf sst clone-max-concurrency "16")
+clone_ssl=$(parse_cnf sst clone-ssl "")
+sst_initial_timeout=$(parse_cnf sst sst-initial-timeout "300")
+clone_progress_interval=$(parse_cnf sst clone-progress-interval "60")
+
+encrypt=$(parse_cnf sst encrypt 0)
+ssl_ca=$(parse_cnf sst ssl-ca "")
+if [[ -z "$ssl_ca" ]]; then
+    ssl_ca=$(parse_cnf mysqld ssl-ca "")
+fi
+ssl_cert=$(parse_cnf sst ssl-cert "")
+if [[ -z "$ssl_cert" ]]; then
+    ssl_cert=$(parse_cnf mysqld ssl-cert "")
+fi
+ssl_key=$(parse_cnf sst ssl-key "")
+if [[ -z "$ssl_key" ]]; then
+    ssl_key=$(parse_cnf mysqld ssl-key "")
+fi
+ssl_dhparams=$(parse_cnf sst ssl-dhparams "")
+
+# If pxc_encrypt_cluster_traffic is set, do the SSL autoconfig
+# (overriding any values already in the config file)
+pxc_encrypt_cluster_traffic=$(parse_cnf mysqld pxc-encrypt-cluster-traffic "")
+pxc_encrypt_cluster_traffic=$(normalize_boolean "$pxc_encrypt_cluster_traffic" "on")
+if [[ "$pxc_encrypt_cluster_traffic" == "on" ]]; then
+    encrypt=4
+    # Look for the [mysqld] files only, not the ones in [sst]
+    ssl_ca=$(parse_cnf mysqld ssl-ca "")
+    ssl_cert=$(parse_cnf mysqld ssl-cert "")
+    ssl_key=$(parse_cnf mysqld ssl-key "")
+    [[ -z "$ssl_ca" && -r "${WSREP_SST_OPT_DATA}/ca.pem" ]] && ssl_ca="${WSREP_SST_OPT_DATA}/ca.pem"
+    [[ -z "$ssl_cert" && -r "${WSREP_SST_OPT_DATA}/server-cert.pem" ]] && ssl_cert="${WSREP_SST_OPT_DATA}/server-cert.pem"
+    [[ -z "$ssl_key" && -r "${WSREP_SST_OPT_DATA}/server-key.pem" ]] && ssl_key="${WSREP_SST_OPT_DATA}/server-key.pem"
+fi
+
+MYSQL_VERSION=$WSREP_SST_OPT_VERSION
+
+SCRATCH_DIR=""
+DONOR_CNF=""
+SCRATCH_PID=""
+PROGRESS_PID=""
+CLONE_DIR="${WSREP_SST_OPT_DATA}/.sst_clone"
+
+cleanup_joiner()
+{
+    wsrep_log_debug "Joiner cleanup. socat PID: ${SOCAT_PID:-}"
+    if [[ -n ${SCRATCH_PID} ]] && ps --pid ${SCRATCH_PID} >/dev/null 2>&1; then
+        kill -9 ${SCRATCH_PID} >/dev/null 2>&1 || :
+    fi
+    if [[ -n ${PROGRESS_PID} ]]; then
+        kill ${PROGRESS_PID} >/dev/null 2>&1 || :
+    fi
+    if [[ -n ${SOCAT_PID:-} ]]; then
+        kill ${SOCAT_PID} >/dev/null 2>&1 || :
+    fi
+    [[ -n ${SCRATCH_DIR} ]] && rm -rf "${SCRATCH_DIR}"
+    rm -rf "${CLONE_DIR}"
+    rm -rf "${MYSQL_UPGRADE_TMPDIR:-}"
+    wsrep_cleanup_progress_file
+    wsrep_log_debug "Joiner cleanup done."
+}
+
+cleanup_donor()
+{
+    if [[ -n ${SOCAT_PID:-} ]]; then
+        kill ${SOCAT_PID} >/dev/null 2>&1 || :
+    fi
+    [[ -n ${DONOR_CNF} ]] && rm -f "${DONOR_CNF}"
+}
+
+# Locates the mysqld binary of the parent server
+#
+# Globals:
+#   WSREP_SST_OPT_PARENT
+#
+# Outputs:
+#   The path to mysqld
+#
+function get_mysqld_path()
+{
+    local path=""
+
+    if [[ -L /proc/${WSREP_SST_OPT_PARENT}/exe ]]; then
+        path=$(readlink -f /proc/${WSREP_SST_OPT_PARENT}/exe)
+    fi
+    if [[ -z $path ]]; then
+        path=$(which ${MYSQLD_NAME})
+    fi
+    echo "$path"
+}
+
+# Creates the directory of the scratch instance below the SST tmpdir
+# ([sst] tmpdir, then [mysqld] tmpdir, then the system default)
+#
+# Outputs:
+#   The path of the new directory
+#
+function create_scratch_dir()
+{
+    local tmpdir_path
+
+    tmpdir_path=$(parse_cnf sst tmpdir "")
+    if [[ -z "${tmpdir_path}" ]]; then
+        tmpdir_path=$(parse_cnf mysqld tmpdir "")
+    fi
+    if [[ -n "${tmpdir_path}" ]]; then
+        if [[ ! -d "${tmpdir_path}" || ! -w "${tmpdir_path}" ]]; then
+            wsrep_log_error "The temporary directory, ${tmpdir_path}, does not exist or is not writable."
+            return 22
+        fi
+        mktemp --tmpdir="${tmpdir_path}" --directory pxc_sst_clone_XXXX
+    else
+        mktemp --tmpdir --directory pxc_sst_clone_XXXX
+    fi
+}
+
+# Builds the socat addresses of the handshake connection.  With encrypt=4
+# the connection uses SSL, the same way xtrabackup-v2 encrypts its stream.
+#
+# Globals:
+#   encrypt, ssl_ca, ssl_cert, ssl_key, ssl_dhparams
+#   HANDSHAKE_LISTEN  (set by this function, joiner side)
+#   HANDSHAKE_CONNECT (set by this function, donor side)
+#
+function setup_handshake_transport()
+{
+    local port=${WSREP_SST_OPT_PORT:-4444}
+    local host=${WSREP_SST_OPT_HOST_UNESCAPED:-$WSREP_SST_OPT_HOST}
+    local ssl_opts socat_version donor_extra=""
+
+    if [[ $encrypt -ne 4 ]]; then
+        HANDSHAKE_LISTEN="TCP-LISTEN:${port},reuseaddr"
+        HANDSHAKE_CONNECT="TCP:${host}:${port},retry=30,interval=1"
+        return 0
+    fi
+
+    if ! socat -V | grep -q WITH_OPENSSL; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "* socat is not openssl enabled.         "
+        wsrep_log_error "* Unable to encrypt SST communications. "
+        wsrep_log_error "* Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        exit 2
+    fi
+    if [[ ! -r "$ssl_ca" || ! -r "$ssl_cert" || ! -r "$ssl_key" ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "* CA, certificate, and key files are required."
+        wsrep_log_error "* ssl-ca='${ssl_ca}' ssl-cert='${ssl_cert}' ssl-key='${ssl_key}'"
+        wsrep_log_error "* Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        exit 2
+    fi
+
+    pushd "${WSREP_SST_OPT_DATA}" &>/dev/null
+    ssl_ca=$(get_absolute_path "$ssl_ca")
+    ssl_cert=$(get_absolute_path "$ssl_cert")
+    ssl_key=$(get_absolute_path "$ssl_key")
+    [[ -n $ssl_dhparams ]] && ssl_dhparams=$(get_absolute_path "$ssl_dhparams")
+    popd &>/dev/null
+
+    ssl_opts="cert=${ssl_cert},key=${ssl_key},cafile=${ssl_ca},verify=1"
+    [[ -n $ssl_dhparams ]] && ssl_opts+=",dhparam=${ssl_dhparams}"
+
+    # socat >= 1.7.3 checks the peer name against the host name and
+    # socat >= 1.7.4 sends SNI, the certificates are not issued per host
+    socat_version=$(socat -V 2>&1 | grep -oe '[0-9]\.[0-9][\.0-9]*' | head -n1)
+    if compare_versions "$socat_version" ">=" "1.7.3"; then
+        donor_extra=",commonname="
+    fi
+    if compare_versions "$socat_version" ">=" "1.7.4"; then
+        donor_extra+=",no-sni=1"
+    fi
+
+    HANDSHAKE_LISTEN="openssl-listen:${port},reuseaddr,${ssl_opts}"
+    HANDSHAKE_CONNECT="openssl-connect:${host}:${port},${ssl_opts}${donor_extra},retry=30,interval=1"
+}
+
+# Resolves an InnoDB directory option of the joiner, a relative path is
+# relative to the datadir
+#
+# Arguments:
+#   Argument 1: the option name
+#
+# Outputs:
+#   The absolute path, empty if the option is not set or names the datadir
+#
+function get_innodb_dir()
+{
+    local dir
+
+    dir=$(parse_cnf mysqld $1 "")
+    [[ -z $dir ]] && return 0
+    [[ $dir != /* ]] && dir="${WSREP_SST_OPT_DATA}/${dir}"
+    mkdir -p "$dir"
+    dir=$(cd "$dir" && pwd -P)
+    [[ $dir == $(cd "${WSREP_SST_OPT_DATA}" && pwd -P) ]] && return 0
+    echo "$dir"
+}
+
+# Removes the old data of the joiner: the datadir, the InnoDB directories
+# and the binary logs, keeping the files that match the [sst] cpat pattern
+# (same default as xtrabackup-v2), the clone directory, the keyring file
+# and the pid file of the running server.
+#
+# Globals:
+#   ib_home_dir, ib_log_dir, ib_undo_dir
+#   CLONE_DIR
+#
+function clean_joiner_dirs()
+{
+    local cpat keyring_file_data dir current_dir
+    local data_dir tempdir binlog_dir binlog_file pattern
+
+    data_dir=$(dirname "${WSREP_SST_OPT_DATA}/xxx")
+    data_dir=$(cd "$data_dir" && pwd -P)
+
+    cpat=$(parse_cnf sst cpat '.*\.pem$\|.*init\.ok$\|.*galera\.cache$\|.*sst_in_progress$\|.*sst-xb-tmpdir$\|.*gvwstate\.dat$\|.*grastate\.dat$\|.*\.err$\|.*\.log$\|.*RPM_UPGRADE_MARKER$\|.*RPM_UPGRADE_HISTORY$')
+    cpat+="\|${data_dir}/$(basename "${CLONE_DIR}")$\|.*\.pid$"
+
+    # Keep the keyring file, and the path to the keyring file and to the
+    # InnoDB directories if they are subdirectories of the datadir
+    keyring_file_data=$(parse_cnf mysqld keyring-file-data "")
+    if [[ -n $keyring_file_data ]]; then
+        cpat+="\|${keyring_file_data}$"
+    fi
+    for dir in "$(dirname "${keyring_file_data:-.}")" $ib_home_dir $ib_log_dir $ib_undo_dir; do
+        if [[ "$dir" != "$data_dir" && "$dir/" =~ $data_dir ]]; then
+            current_dir=$(dirname "$dir/xx")
+            while [[ $current_dir != "." && $current_dir != "/" && $current_dir != "$data_dir" ]]; do
+                cpat+="\|${current_dir}$"
+                current_dir=$(dirname "$current_dir")
+            done
+        fi
+    done
+
+    wsrep_log_debug "Cleaning the existing datadir and innodb-data/log directories"
+    find $ib_home_dir $ib_log_dir $ib_undo_dir "$data_dir" -mindepth 1 \
+        -regex "$cpat" -prune -o -exec rm -rfv {} 1>/dev/null \+
+
+    # Clean the binlog dir (if it's explicitly specified)
+    # By default it'll be in the datadir
+    tempdir=$(parse_cnf mysqld log-bin "")
+    if [[ -n "$tempdir" ]]; then
+        binlog_dir=$(dirname "$tempdir")
+        binlog_file=$(basename "$tempdir")
+        if [[ -n ${binlog_dir:-} && "$binlog_dir" != '.' && "$binlog_dir" != "$data_dir" ]]; then
+            pattern="$binlog_dir/$binlog_file\.[0-9]+$"
+            wsrep_log_debug "Cleaning the binlog directory $binlog_dir as well"
+            find "$binlog_dir" -maxdepth 1 -type f -regex $pattern -exec rm -fv {} 1>&2 \+ || true
+            rm -f $binlog_dir/*.index || true
+        fi
+    fi
+}
+
+# Moves the cloned data into place: the system tablespace files, the redo
+# logs and the undo tablespaces into their configured directories, and
+# everything else into the datadir.
+#
+# Globals:
+#   ib_home_dir, ib_log_dir, ib_undo_dir
+#   CLONE_DIR
+#
+function move_cloned_data()
+{
+    local file
+
+    if [[ -n $ib_home_dir ]]; then
+        for file in $(parse_cnf mysqld innodb-data-file-path "ibdata1:12M:autoextend" | tr ';' '\n' | cut -d: -f1); do
+            if [[ -e "${CLONE_DIR}/${file}" ]]; then
+                mkdir -p "$(dirname "${ib_home_dir}/${file}")"
+                mv "${CLONE_DIR}/${file}" "${ib_home_dir}/${file}"
+            fi
+        done
+    fi
+    if [[ -n $ib_log_dir ]]; then
+        find "${CLONE_DIR}" -mindepth 1 -maxdepth 1 -name "ib_logfile*" \
+            -exec mv -t "${ib_log_dir}" {} \+
+    fi
+    if [[ -n $ib_undo_dir ]]; then
+        find "${CLONE_DIR}" -mindepth 1 -maxdepth 1 -regex ".*/undo_[0-9]+$" \
+            -exec mv -t "${ib_undo_dir}" {} \+
+    fi
+    find "${CLONE_DIR}" -mindepth 1 -maxdepth 1 ! -name "#clone" \
+        -exec mv -t "${WSREP_SST_OPT_DATA}" {} \+
+}
+
+# Adds the settings of the joiner that the scratch (recipient) instance
+# has to share to scratch_opts.  The clone plugin requires the page size,
+# the system tablespace layout and the keyring to match the donor, and
+# the cloned data has to be readable by the joiner with its own settings.
+# The recipient re-encrypts the tablespace keys with its master key, so it
+# works on a copy of the joiner's keyring file that later replaces it.
+#
+# Globals:
+#   SCRATCH_DIR
+#   scratch_opts (appended to)
+#   scratch_keyring (set by this function if a keyring file is used)
+#
+function add_scratch_config_opts()
+{
+    local opt value
+    local keyring_file_data keyring_vault_config early_plugins
+
+    for opt in innodb-page-size innodb-data-file-path innodb-log-file-size \
+               innodb-log-files-in-group innodb-undo-tablespaces \
+               innodb-redo-log-encrypt innodb-undo-log-encrypt \
+               lower-case-table-names; do
+        value=$(parse_cnf mysqld $opt "")
+        [[ -n $value ]] && scratch_opts+=" --${opt}=${value}"
+    done
+
+    keyring_file_data=$(parse_cnf mysqld keyring-file-data "")
+    keyring_vault_config=$(parse_cnf mysqld keyring-vault-config "")
+    early_plugins=$(parse_cnf mysqld early-plugin-load "")
+    if [[ -n $keyring_file_data && -n $keyring_vault_config ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "Only one of keyring-file-data and keyring-vault-config"
+        wsrep_log_error "can be set"
+        wsrep_log_error "Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        return 22
+    fi
+
+    if [[ -n $keyring_file_data ]]; then
+        scratch_keyring="${SCRATCH_DIR}/keyring"
+        if [[ -r $keyring_file_data ]]; then
+            cp -p "$keyring_file_data" "$scratch_keyring"
+        fi
+        scratch_opts+=" --early-plugin-load=${early_plugins:-keyring_file.so}"
+        scratch_opts+=" --keyring-file-data=${scratch_keyring}"
+    elif [[ -n $keyring_vault_config ]]; then
+        scratch_opts+=" --early-plugin-load=${early_plugins:-keyring_vault.so}"
+        scratch_opts+=" --keyring-vault-config=${keyring_vault_config}"
+    elif [[ $early_plugins =~ keyring ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "SST method 'clone' supports the keyring_file and"
+        wsrep_log_error "keyring_vault plugins only (early-plugin-load=${early_plugins})"
+        wsrep_log_error "Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        return 22
+    fi
+    return 0
+}
+
+# Runs a statement on the scratch (recipient) instance.  The statement is
+# passed on stdin, so that credentials do not show up in the process list.
+#
+# Globals:
+#   SCRATCH_DIR
+#   mysql_client_path
+#
+# Arguments:
+#   Argument 1: the statement(s)
+#   Argument 2: file receiving the output
+#
+function scratch_execute()
+{
+    printf '%s\n' "$1" | $mysql_client_path --no-defaults --user=root \
+        --socket="${SCRATCH_DIR}/mysqld.sock" \
+        --unbuffered --batch --silent --skip-column-names &> "$2"
+}
+
+# Periodically logs the current clone stage, the amount of data applied
+# and the transfer rate, taken from performance_schema.clone_progress of
+# the scratch instance.  The lines end up in the joiner's error log.
+#
+# Globals:
+#   SCRATCH_DIR
+#   mysql_client_path
+#
+# Arguments:
+#   Argument 1: reporting interval in seconds
+#
+function report_clone_progress()
+{
+    local interval=$1
+    local progress
+
+    while sleep ${interval}; do
+        progress=$($mysql_client_path --no-defaults --user=root \
+            --socket="${SCRATCH_DIR}/mysqld.sock" \
+            --batch --silent --skip-column-names \
+            -e "SELECT STAGE, ESTIMATE, DATA, NETWORK, DATA_SPEED
+                FROM performance_schema.clone_progress
+                WHERE STATE = 'In Progress'" 2>/dev/null)
+        [[ -z $progress ]] && continue
+
+        wsrep_log_info "Clone progress: $(echo "$progress" | awk -F'\t' '{
+            eta = ($5 > 0 && $2 > $3) ? int(($2 - $3) / $5) : 0
+            printf "stage %s, %d of %d MiB applied, %d MiB received, %d MiB/s, ETA %ds",
+                   $1, $3 / 1048576, $2 / 1048576, $4 / 1048576, $5 / 1048576, eta
+        }')"
+    done
+}
+
+if [[ "$WSREP_SST_OPT_ROLE" == "donor" ]]; then
+
+    trap cleanup_donor EXIT
+
+    read_variables_from_stdin
+    setup_handshake_transport
+
+    # The credentials go through a private (0600) option file, so that
+    # the password does not show up in the process list
+    DONOR_CNF=$(mktemp --tmpdir pxc_sst_clone_XXXX.cnf)
+    printf '[client]\nuser=%s\npassword=%s\n' \
+        "${WSREP_SST_OPT_USER}" "${WSREP_SST_OPT_PSWD}" > "${DONOR_CNF}"
+
+    donor_info=$($MYSQL_CLIENT --defaults-file="${DONOR_CNF}" \
+                   --socket="${WSREP_SST_OPT_SOCKET}" \
+                   --batch --silent --skip-column-names \
+                   -e "SELECT @@port,
+                         (SELECT IFNULL(SUM(FILE_SIZE), 0)
+                            FROM information_schema.INNODB_TABLESPACES) +
+                         @@innodb_log_file_size * @@innodb_log_files_in_group,
+                         @@wsrep_node_address" 2>/dev/null)
+    if [[ -z $donor_info ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "Failed to read the donor address from the server"
+        wsrep_log_error "Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        exit 22
+    fi
+    donor_port=$(echo "$donor_info" | awk -F'\t' '{ print $1 }')
+    # Size of the InnoDB tablespaces and redo logs, which is what the
+    # joiner receives
+    donor_size=$(echo "$donor_info" | awk -F'\t' '{ print $2 }')
+    donor_host=$(echo "$donor_info" | awk -F'\t' '{ print $3 }')
+    # wsrep_node_address may carry the galera port
+    donor_host=${donor_host%%:*}
+    if [[ -z $donor_host ]]; then
+        donor_host=$(hostname -I | awk '{ print $1 }')
+    fi
+
+    coproc SOCAT { exec socat STDIO "${HANDSHAKE_CONNECT}"; }
+    # Keep our own copies: the coproc variables vanish when socat exits
+    exec 3<&"${SOCAT[0]}" 4>&"${SOCAT[1]}"
+
+    if [[ $WSREP_SST_OPT_BYPASS -eq 0 ]]; then
+        wsrep_log_info "Streaming clone credentials to ${WSREP_SST_OPT_HOST}"
+        echo "clone ${donor_host} ${donor_port} ${CLONE_USER} ${WSREP_SST_OPT_CLONE_PSWD} ${donor_size}" >&4
+    else
+        wsrep_log_info "Bypassing SST. Can work it through IST"
+        echo "bypass ${WSREP_SST_OPT_GTID}" >&4
+    fi
+
+    # Wait for the joiner to report the end of the clone
+    reply=""
+    read -r reply <&3 || :
+    if [[ $reply != "done" ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "JOINER failed the clone: '${reply}'"
+        wsrep_log_error "****************************************************** "
+        exit 32 # EPIPE
+    fi
+
+    echo "done ${WSREP_SST_OPT_GTID}"
+
+elif [[ "${WSREP_SST_OPT_ROLE}" == "joiner" ]]; then
+
+    [[ -e $SST_PROGRESS_FILE ]] && wsrep_log_warning "Found a stale sst_in_progress file: $SST_PROGRESS_FILE"
+    [[ -n $SST_PROGRESS_FILE ]] && touch $SST_PROGRESS_FILE
+
+    trap cleanup_joiner EXIT
+
+    # The clone plugin writes every InnoDB file into the clone directory,
+    # files for separately configured directories are moved there later.
+    ib_home_dir=$(get_innodb_dir innodb-data-home-dir)
+    ib_log_dir=$(get_innodb_dir innodb-log-group-home-dir)
+    ib_undo_dir=$(get_innodb_dir innodb-undo-directory)
+
+    mysqld_path=$(get_mysqld_path)
+    mysql_client_path=$MYSQL_CLIENT
+    mysqladmin_path=$(which ${MYSQLADMIN_NAME})
+
+    setup_handshake_transport
+    coproc SOCAT { exec socat "${HANDSHAKE_LISTEN}" STDIO; }
+    # Keep our own copies: the coproc variables vanish when socat exits
+    exec 3<&"${SOCAT[0]}" 4>&"${SOCAT[1]}"
+
+    echo "ready ${WSREP_SST_OPT_HOST}:${WSREP_SST_OPT_PORT:-4444}/${CLONE_MODULE}"
+
+    handshake=""
+    if ! read -r -t ${sst_initial_timeout} handshake <&3; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "Possible timeout in receiving first data from donor"
+        wsrep_log_error "Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        exit 32
+    fi
+
+    read -r kind donor_host donor_port clone_user clone_password donor_size <<< "$handshake"
+
+    if [[ $kind == "bypass" ]]; then
+        wsrep_log_info "Bypassing SST, donor position: ${donor_host}"
+        echo "done" >&4
+        echo "${donor_host}" # output UUID:seqno
+        exit 0
+    fi
+
+    if [[ $kind != "clone" || -z $clone_password ]]; then
+        wsrep_log_error "Unexpected handshake from donor"
+        echo "error" >&4
+        exit 22
+    fi
+
+    #-----------------------------------------------------------------------
+    # Start the scratch recipient instance
+    if ! SCRATCH_DIR=$(create_scratch_dir); then
+        echo "error" >&4
+        exit 22
+    fi
+    scratch_log="${SCRATCH_DIR}/mysqld.log"
+    scratch_opts="--no-defaults --datadir=${SCRATCH_DIR}/data \
+        --log-error=${scratch_log}"
+    if [[ -n $WSREP_SST_OPT_BASEDIR ]]; then
+        scratch_opts+=" --basedir=${WSREP_SST_OPT_BASEDIR}"
+    fi
+    if [[ -n $WSREP_SST_OPT_PLUGINDIR ]]; then
+        scratch_opts+=" --plugin-dir=${WSREP_SST_OPT_PLUGINDIR}"
+    fi
+    scratch_keyring=""
+    if ! add_scratch_config_opts; then
+        echo "error" >&4
+        exit 22
+    fi
+
+    wsrep_log_info "Initializing the clone recipient instance"
+    if ! $mysqld_path $scratch_opts --initialize-insecure; then
+        cat_file_to_stderr "${scratch_log}" "ERR" "clone recipient log"
+        echo "error" >&4
+        exit 3
+    fi
+
+    $mysqld_path $scratch_opts --skip-networking --wsrep-provider=none \
+        --server-id=1 --skip-log-bin \
+        --plugin-load-add=mysql_clone.so \
+        --pid-file=${SCRATCH_DIR}/mysqld.pid \
+        --socket=${SCRATCH_DIR}/mysqld.sock &>> ${scratch_log} &
+    SCRATCH_PID=$!
+
+    if ! wait_for_mysqld_startup "${SCRATCH_PID}" "${SCRATCH_DIR}/mysqld.sock" "300" \
+        "${scratch_log}" "root" "" "clone recipient instance"; then
+        echo "error" >&4
+        exit 3
+    fi
+
+    #-----------------------------------------------------------------------
+    # Make room for the cloned data: the old data is removed first (as
+    # xtrabackup-v2 does), so the datadir filesystem only has to hold one
+    # copy of the data. The clone directory is inside the datadir, moving
+    # the files into place afterwards does not need extra space.
+    rm -rf "${CLONE_DIR}"
+    clean_joiner_dirs
+
+    free_space=$(df -P -k "${WSREP_SST_OPT_DATA}" | awk 'NR == 2 { print $4 * 1024 }')
+    if [[ ${donor_size:-} =~ ^[0-9]+$ && $free_space =~ ^[0-9]+$ ]] && (( donor_size > free_space )); then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "Not enough free space in ${WSREP_SST_OPT_DATA} for the cloned data:"
+        wsrep_log_error "the donor has $(( donor_size / 1048576 )) MiB of InnoDB data," \
+                        " $(( free_space / 1048576 )) MiB are available"
+        wsrep_log_error "Line $LINENO"
+        wsrep_log_error "****************************************************** "
+        echo "error" >&4
+        exit 28 # ENOSPC
+    fi
+
+    #-----------------------------------------------------------------------
+    # Clone
+    ssl_clause=""
+    case "${clone_ssl,,}" in
+        on|1|true)  ssl_clause="REQUIRE SSL" ;;
+        off|0|false) ssl_clause="REQUIRE NO SSL" ;;
+    esac
+
+    wsrep_log_info "Cloning from ${donor_host}:${donor_port}" \
+                   " (clone_max_concurrency=${clone_max_concurrency})"
+    if [[ ${clone_progress_interval} -gt 0 ]]; then
+        report_clone_progress ${clone_progress_interval} &
+        PROGRESS_PID=$!
+    fi
+
+    set +e
+    scratch_execute "SET GLOBAL clone_valid_donor_list='${donor_host}:${donor_port}';
+        SET GLOBAL clone_max_concurrency=${clone_max_concurrency};
+        CLONE INSTANCE FROM '${clone_user}'@'${donor_host}':${donor_port}
+          IDENTIFIED BY '${clone_password}'
+          DATA DIRECTORY = '${CLONE_DIR}' ${ssl_clause};" \
+        "${SCRATCH_DIR}/clone.out"
+    errcode=$?
+    set -e
+    clone_password=""
+
+    if [[ -n ${PROGRESS_PID} ]]; then
+        kill ${PROGRESS_PID} >/dev/null 2>&1 || :
+        wait ${PROGRESS_PID} 2>/dev/null || :
+        PROGRESS_PID=""
+    fi
+
+    scratch_execute "SHUTDOWN" "${SCRATCH_DIR}/shutdown.out" || kill -9 ${SCRATCH_PID}
+    wait_for_mysqld_shutdown ${SCRATCH_PID} 300 "clone recipient instance" || :
+    SCRATCH_PID=""
+
+    if [[ $errcode -ne 0 ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "CLONE INSTANCE failed with error $errcode"
+        cat_file_to_stderr "${SCRATCH_DIR}/clone.out" "ERR" "clone output"
+        if grep -q "Access denied" "${SCRATCH_DIR}/clone.out"; then
+            wsrep_log_error "The clone account on the donor only accepts connections"
+            wsrep_log_error "from the address of ${WSREP_SST_OPT_HOST}. Make sure that the"
+            wsrep_log_error "donor's port ${donor_port} is reached from that address, or set"
+            wsrep_log_error "wsrep_sst_receive_address to the address that is used."
+        fi
+        wsrep_log_error "****************************************************** "
+        echo "error" >&4
+        exit 32
+    fi
+
+    # The donor is done, let it leave the DONOR state
+    echo "done" >&4
+
+    #-----------------------------------------------------------------------
+    # Move the cloned data into place
+    move_cloned_data
+
+    # The tablespace keys of the cloned data are in the recipient's keyring
+    if [[ -n $scratch_keyring && -s $scratch_keyring ]]; then
+        wsrep_log_info "Installing the keyring file of the cloned data"
+        keyring_file_data=$(parse_cnf mysqld keyring-file-data "")
+        rm -f "${keyring_file_data}.backup"
+        cp -p "$scratch_keyring" "$keyring_file_data"
+    fi
+
+    #-----------------------------------------------------------------------
+    # Recover the galera position of the cloned data
+    recover_log="${SCRATCH_DIR}/wsrep_recover.log"
+    use_conf_suffix=""
+    if [[ -n $WSREP_SST_OPT_CONF_SUFFIX ]]; then
+      use_conf_suffix="--defaults-group-suffix=${WSREP_SST_OPT_CONF_SUFFIX}"
+    fi
+    $mysqld_path --defaults-file=${WSREP_SST_OPT_CONF} ${use_conf_suffix} \
+        --datadir=${WSREP_SST_OPT_DATA} --wsrep-recover \
+        --log-error=${recover_log} --pid-file=${SCRATCH_DIR}/recover.pid \
+        --socket=${SCRATCH_DIR}/recover.sock &> /dev/null || :
+
+    recovered=$(grep '\[WSREP\] Recovered position:' ${recover_log} | \
+                sed 's/.*WSREP\]\ Recovered\ position://' | sed 's/^[ \t]*//')
+    if [[ -z $recovered ]]; then
+        wsrep_log_error "******************* FATAL ERROR ********************** "
+        wsrep_log_error "Failed to recover the position of the cloned data"
+        cat_file_to_stderr "${recover_log}" "ERR" "wsrep recovery log"
+        wsrep_log_error "****************************************************** "
+        exit 2
+    fi
+
+    wsrep_log_info "Running post-processing..........."
+    set +e
+    run_post_processing_steps "${WSREP_SST_OPT_DATA}" "${WSREP_SST_OPT_PORT:-4444}" \
+            "$MYSQL_VERSION" "$MYSQL_VERSION" "clone" "sst" "$force_upgrade" "$auto_upgrade"
+    errcode=$?
+    set -e
+    if [[ $errcode -ne 0 ]]; then
+        wsrep_log_info "...........post-processing failed.  Exiting"
+        exit $errcode
+    fi
+    wsrep_log_info "...........post-processing done"
+
+    wsrep_log_info "Galera co-ords from recovery: ${recovered}"
+    echo "${recovered}" # output UUID:seqno
+fi
+
+exit 0
@@ -26,6 +26,7 @@ WSREP_SST_OPT_BASEDIR=""
 WSREP_SST_OPT_PLUGINDIR=""
 WSREP_SST_OPT_USER=""
 WSREP_SST_OPT_PSWD=""
+WSREP_SST_OPT_CLONE_PSWD=""
 WSREP_SST_OPT_VERSION=""
 WSREP_SST_OPT_DEBUG=""
 
@@ -969,6 +970,9 @@ function read_variables_from_stdin()
             'sst_password')
                 WSREP_SST_OPT_PSWD="$value"
                 ;;
+            'sst_clone_password')
+                WSREP_SST_OPT_CLONE_PSWD="$value"
+                ;;
             *)
                 wsrep_log_warning "Unrecognized input: $line"
         esac
@@ -44,6 +44,7 @@ SST_PORT=""
 REMOTEIP=""
 sockopt=""
 ncsockopt=""
+socat_blksize=""
 progress=""
 ttime=0
 totime=0
@@ -580,6 +581,13 @@ get_transfer()
 
         fi
 
+        # A larger transfer block size (socat -b, default 8192) reduces
+        # the number of read/write calls on fast links
+        local socatopts=""
+        if [[ -n "${socat_blksize}" ]]; then
+            socatopts="-b ${socat_blksize}"
+        fi
+
         # prepend a comma if it's not already there
         if [[ -n "${sockopt}" ]] && [[ "${sockopt}" != ","* ]]; then
             sockopt=",${sockopt}"
@@ -611,17 +619,17 @@ get_transfer()
             stagemsg+="-OpenSSL-Encrypted-4"
             if [[ "$WSREP_SST_OPT_ROLE"  == "joiner" ]]; then
                 wsrep_log_debug "Decrypting with SSL. CERT: $ssl_cert, KEY: $ssl_key, CA: $ssl_ca"
-                tcmd="socat -u openssl-listen:${TSST_PORT},reuseaddr,cert=${ssl_cert},key=${ssl_key},cafile=${ssl_ca},verify=1${joiner_extra}${sockopt} stdio"
+                tcmd="socat ${socatopts} -u openssl-listen:${TSST_PORT},reuseaddr,cert=${ssl_cert},key=${ssl_key},cafile=${ssl_ca},verify=1${joiner_extra}${sockopt} stdio"
             else
                 wsrep_log_debug "Encrypting with SSL. CERT: $ssl_cert, KEY: $ssl_key, CA: $ssl_ca"
-                tcmd="socat -u stdio openssl-connect:${REMOTEIP}:${TSST_PORT},cert=${ssl_cert},key=${ssl_key},cafile=${ssl_ca},verify=1${donor_extra}${sockopt}"
+                tcmd="socat ${socatopts} -u stdio openssl-connect:${REMOTEIP}:${TSST_PORT},cert=${ssl_cert},key=${ssl_key},cafile=${ssl_ca},verify=1${donor_extra}${sockopt}"
             fi
 
         else
             if [[ "$WSREP_SST_OPT_ROLE"  == "joiner" ]]; then
-                tcmd="socat -u TCP-LISTEN:${TSST_PORT},reuseaddr${sockopt} stdio"
+                tcmd="socat ${socatopts} -u TCP-LISTEN:${TSST_PORT},reuseaddr${sockopt} stdio"
             else
-                tcmd="socat -u stdio TCP:${REMOTEIP}:${TSST_PORT}${sockopt}"
+                tcmd="socat ${socatopts} -u stdio TCP:${REMOTEIP}:${TSST_PORT}${sockopt}"
             fi
         fi
     fi
@@ -636,6 +644,7 @@ read_cnf()
     encrypt=$(parse_cnf sst encrypt 0)
     sockopt=$(parse_cnf sst sockopt "")
     ncsockopt=$(parse_cnf sst ncsockopt "")
+    socat_blksize=$(parse_cnf sst socat-block-size "")
     rebuild=$(parse_cnf sst rebuild 0)
     ttime=$(parse_cnf sst time 0)
     scomp=$(parse_cnf sst compressor "")
@@ -857,6 +866,12 @@ get_stream()
         # It's ok to use the 8.0 xbstream, it's compatible with
         # the 2.4 xbstream.
         if [[ "$WSREP_SST_OPT_ROLE"  == "joiner" ]]; then
+            # Extract with as many threads as the donor uses to stream
+            # (if not already specified), a single writer cannot keep up
+            # with a fast link.
+            if [[ ! "$xbstream_opts" =~ --parallel= ]]; then
+                xbstream_opts+=" --parallel=$backup_threads"
+            fi
             strmcmd="${XTRABACKUP_80_PATH}/bin/xbstream -x $xbstream_opts"
         else
             strmcmd="${XTRABACKUP_80_PATH}/bin/xbstream -c $xbstream_opts \${FILE_TO_STREAM}"
@@ -361,13 +361,19 @@ std::pair<bool, bool> Caching_sha2_password::fast_authenticate(
     return std::make_pair(true, false);
   }
 
-  rwlock_scoped_lock rdlock(&m_cache_lock, false, __FILE__, __LINE__);
   sha2_cache_entry digest;
 
-  if (m_cache.search(authorization_id, digest)) {
-    DBUG_PRINT("info", ("Could not find entry for %s in cache.",
-                        authorization_id.c_str()));
-    return std::make_pair(true, false);
+  {
+    /*
+      search() copies the entry out, so the lock is held only for the
+      lookup and not while the scramble is validated.
+    */
+    rwlock_scoped_lock rdlock(&m_cache_lock, false, __FILE__, __LINE__);
+    if (m_cache.search(authorization_id, digest)) {
+      DBUG_PRINT("info", ("Could not find entry for %s in cache.",
+                          authorization_id.c_str()));
+      return std::make_pair(true, false);
+    }
   }
 
   /* Entry found, so validate scramble against it */
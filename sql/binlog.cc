@@ -1465,7 +1465,7 @@ static int binlog_close_connection(handlerton *, THD *thd) {
   if (!cache_mngr->is_binlog_empty()) {
     /* binlog should be empty during close connection. pending binlog represent
     node was shutdown with replication leftover. */
-    uchar *buf;
+    uchar *buf = nullptr;
     size_t len = 0;
 
     IO_CACHE_binlog_cache_storage *trx_cache = wsrep_get_trans_cache(thd, true);
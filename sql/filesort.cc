@@ -614,7 +614,8 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                                                        : "rowid");
     sort_mode.append(">");
 
-    const char *algo_text[] = {"none", "std::sort", "std::stable_sort"};
+    const char *algo_text[] = {"none", "std::sort", "std::stable_sort",
+                               "radix_sort"};
 
     Opt_trace_object filesort_summary(trace, "filesort_summary");
     filesort_summary.add("memory_available", memory_available)
@@ -135,8 +135,50 @@ class Equality_from_less {
   const Comp &m_comp;
 };
 
+/*
+  Radix sort does one pass over the pointers per key byte, while a comparison
+  sort needs about log2(n) comparisons per element. It only wins for short
+  keys and enough rows, and beyond some size the random scatter makes it
+  cache-bound again.
+*/
+constexpr size_t RADIX_SORT_MAX_KEY_LEN = 20;
+constexpr size_t RADIX_SORT_MIN_ROWS = 10000;
+constexpr size_t RADIX_SORT_MAX_ROWS = 1000000;
+
+inline bool radixsort_is_applicable(size_t num_rows, size_t key_len) {
+  return key_len <= RADIX_SORT_MAX_KEY_LEN && num_rows >= RADIX_SORT_MIN_ROWS &&
+         num_rows <= RADIX_SORT_MAX_ROWS;
+}
+
 }  // namespace
 
+void radixsort_for_str_ptr(uchar **base, size_t number_of_elements,
+                           size_t size_of_element, uchar **buffer) {
+  uchar **src = base;
+  uchar **dst = buffer;
+
+  for (size_t pos = size_of_element; pos-- > 0;) {
+    size_t count[256] = {};
+    for (size_t ix = 0; ix < number_of_elements; ++ix) ++count[src[ix][pos]];
+
+    // All keys have the same byte here, e.g. a NULL indicator or the high
+    // bytes of small integers, so this pass would not change the order.
+    if (count[src[0][pos]] == number_of_elements) continue;
+
+    size_t offset = 0;
+    for (size_t &bucket : count) {
+      const size_t bucket_size = bucket;
+      bucket = offset;
+      offset += bucket_size;
+    }
+    for (size_t ix = 0; ix < number_of_elements; ++ix)
+      dst[count[src[ix][pos]]++] = src[ix];
+    std::swap(src, dst);
+  }
+
+  if (src != base) memcpy(base, src, number_of_elements * sizeof(uchar *));
+}
+
 size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                                     size_t max_output_rows) {
   const bool force_stable_sort = param->m_force_stable_sort;
@@ -230,6 +272,30 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
     return std::min(num_input_rows, max_output_rows);
   }
 
+  if (radixsort_is_applicable(num_input_rows, key_len)) {
+    uchar **buffer = static_cast<uchar **>(
+        my_malloc(key_memory_Filesort_buffer_sort_keys,
+                  num_input_rows * sizeof(uchar *), MYF(0)));
+    // Fall back to std::stable_sort if we cannot get the scratch array.
+    if (buffer != nullptr) {
+      param->m_sort_algorithm = Sort_param::FILESORT_ALG_RADIX;
+      if (prefilter_nth_element) {
+        nth_element(it_begin, it_begin + max_output_rows - 1, it_end,
+                    Mem_compare(key_len));
+        it_end = it_begin + max_output_rows;
+      }
+      radixsort_for_str_ptr(&*it_begin, it_end - it_begin, key_len, buffer);
+      my_free(buffer);
+      if (param->m_remove_duplicates) {
+        num_input_rows =
+            unique(it_begin, it_end,
+                   Equality_from_less<Mem_compare>(Mem_compare(key_len))) -
+            it_begin;
+      }
+      return std::min(num_input_rows, max_output_rows);
+    }
+  }
+
   param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_STABLE;
   // Heuristics here: avoid function overhead call for short keys.
   if (key_len < 10) {
@@ -282,4 +282,16 @@ class Filesort_buffer {
   Filesort_buffer &operator=(Filesort_buffer &&rhs) = default;
 };
 
+/**
+  Stable LSD radix sort of pointers to fixed-length keys that compare
+  byte-by-byte, like filesort keys do.
+
+  @param base               Array of pointers to the keys, sorted in place.
+  @param number_of_elements Number of elements in base.
+  @param size_of_element    Number of key bytes to sort on.
+  @param buffer             Scratch array of number_of_elements pointers.
+*/
+void radixsort_for_str_ptr(uchar **base, size_t number_of_elements,
+                           size_t size_of_element, uchar **buffer);
+
 #endif  // FILESORT_UTILS_INCLUDED
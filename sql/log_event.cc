@@ -11933,6 +11933,18 @@ int Write_rows_log_event::do_before_row_operations(
 
   m_table->file->rpl_before_write_rows();
 
+#ifdef WITH_WSREP
+  /* Report the stage once per event rather than once per row. */
+  if (WSREP(thd)) {
+    THD_STAGE_INFO(thd, stage_wsrep_writing_rows);
+    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
+             "wsrep: writing rows for write-set (%lld)",
+             (long long)wsrep_thd_trx_seqno(thd));
+    WSREP_DEBUG("%s", thd->wsrep_info);
+    thd_proc_info(thd, thd->wsrep_info);
+  }
+#endif /* WITH_WSREP */
+
   /*
     Increment the global status insert count variable
   */
@@ -12344,17 +12356,6 @@ error:
 int Write_rows_log_event::do_exec_row(const Relay_log_info *const rli) {
   DBUG_ASSERT(m_table != nullptr);
 
-#ifdef WITH_WSREP
-  if (WSREP(thd)) {
-    THD_STAGE_INFO(thd, stage_wsrep_writing_rows);
-    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
-             "wsrep: writing row for write-set (%lld)",
-             (long long)wsrep_thd_trx_seqno(thd));
-    WSREP_DEBUG("%s", thd->wsrep_info);
-    thd_proc_info(thd, thd->wsrep_info);
-  }
-#endif /* WITH_WSREP */
-
   int error = write_row(rli, rbr_exec_mode == RBR_EXEC_MODE_IDEMPOTENT);
 
   if (error && !thd->is_error()) {
@@ -12429,6 +12430,18 @@ int Delete_rows_log_event::do_before_row_operations(
   int error = 0;
   DBUG_TRACE;
   m_table->file->rpl_before_delete_rows();
+
+#ifdef WITH_WSREP
+  /* Report the stage once per event rather than once per row. */
+  if (WSREP(thd)) {
+    THD_STAGE_INFO(thd, stage_wsrep_deleting_rows);
+    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
+             "wsrep: deleting rows for write-set (%lld)",
+             (long long)wsrep_thd_trx_seqno(thd));
+    WSREP_DEBUG("%s", thd->wsrep_info);
+    thd_proc_info(thd, thd->wsrep_info);
+  }
+#endif /* WITH_WSREP */
   /*
     Increment the global status delete count variable
    */
@@ -12464,17 +12477,6 @@ int Delete_rows_log_event::do_exec_row(const Relay_log_info *const rli) {
     if (error) return error;
   }
 
-#ifdef WITH_WSREP
-  if (WSREP(thd)) {
-    THD_STAGE_INFO(thd, stage_wsrep_deleting_rows);
-    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
-             "wsrep: deleting row for write-set (%lld)",
-             (long long)wsrep_thd_trx_seqno(thd));
-    WSREP_DEBUG("%s", thd->wsrep_info);
-    thd_proc_info(thd, thd->wsrep_info);
-  }
-#endif /* WITH_WSREP */
-
   /* m_table->record[0] contains the BI */
   m_table->mark_columns_per_binlog_row_image(thd);
   error = m_table->file->ha_delete_row(m_table->record[0]);
@@ -12576,6 +12578,18 @@ int Update_rows_log_event::do_before_row_operations(
   int error = 0;
   DBUG_TRACE;
   m_table->file->rpl_before_update_rows();
+
+#ifdef WITH_WSREP
+  /* Report the stage once per event rather than once per row. */
+  if (WSREP(thd)) {
+    THD_STAGE_INFO(thd, stage_wsrep_updating_rows);
+    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
+             "wsrep: updating rows for write-set (%lld)",
+             (long long)wsrep_thd_trx_seqno(thd));
+    WSREP_DEBUG("%s", thd->wsrep_info);
+    thd_proc_info(thd, thd->wsrep_info);
+  }
+#endif /* WITH_WSREP */
   /*
     Increment the global status update count variable
   */
@@ -12642,17 +12656,6 @@ int Update_rows_log_event::do_exec_row(const Relay_log_info *const rli) {
   DBUG_DUMP("old record", m_table->record[1], m_table->s->reclength);
   DBUG_DUMP("new values", m_table->record[0], m_table->s->reclength);
 
-#ifdef WITH_WSREP
-  if (WSREP(thd)) {
-    THD_STAGE_INFO(thd, stage_wsrep_updating_rows);
-    snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
-             "wsrep: updating row for write-set (%lld)",
-             (long long)wsrep_thd_trx_seqno(thd));
-    WSREP_DEBUG("%s", thd->wsrep_info);
-    thd_proc_info(thd, thd->wsrep_info);
-  }
-#endif /* WITH_WSREP */
-
   m_table->mark_columns_per_binlog_row_image(thd);
   error = m_table->file->ha_update_row(m_table->record[1], m_table->record[0]);
   if (error == HA_ERR_RECORD_IS_THE_SAME) error = 0;
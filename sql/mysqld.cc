@@ -1568,6 +1568,8 @@ mysql_mutex_t LOCK_wsrep_cluster_config;
 mysql_mutex_t LOCK_wsrep_desync;
 mysql_mutex_t LOCK_wsrep_group_commit;
 mysql_cond_t COND_wsrep_group_commit;
+mysql_mutex_t LOCK_wsrep_sync_wait;
+mysql_cond_t COND_wsrep_sync_wait;
 mysql_mutex_t LOCK_wsrep_SR_pool;
 mysql_mutex_t LOCK_wsrep_SR_store;
 mysql_mutex_t LOCK_wsrep_alter_tablespace;
@@ -2956,6 +2958,8 @@ static void clean_up_mutexes() {
   mysql_mutex_destroy(&LOCK_wsrep_desync);
   mysql_mutex_destroy(&LOCK_wsrep_group_commit);
   mysql_cond_destroy(&COND_wsrep_group_commit);
+  mysql_mutex_destroy(&LOCK_wsrep_sync_wait);
+  mysql_cond_destroy(&COND_wsrep_sync_wait);
   mysql_mutex_destroy(&LOCK_wsrep_SR_pool);
   mysql_mutex_destroy(&LOCK_wsrep_SR_store);
   mysql_mutex_destroy(&LOCK_wsrep_alter_tablespace);
@@ -5808,6 +5812,9 @@ static int init_thread_environment() {
   mysql_mutex_init(key_LOCK_wsrep_group_commit, &LOCK_wsrep_group_commit,
                    MY_MUTEX_INIT_FAST);
   mysql_cond_init(key_COND_wsrep_group_commit, &COND_wsrep_group_commit);
+  mysql_mutex_init(key_LOCK_wsrep_sync_wait, &LOCK_wsrep_sync_wait,
+                   MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_COND_wsrep_sync_wait, &COND_wsrep_sync_wait);
   mysql_mutex_init(key_LOCK_wsrep_SR_pool, &LOCK_wsrep_SR_pool,
                    MY_MUTEX_INIT_FAST);
   mysql_mutex_init(key_LOCK_wsrep_SR_store, &LOCK_wsrep_SR_store,
@@ -12641,6 +12648,7 @@ PSI_mutex_key key_LOCK_wsrep_cluster_config;
 PSI_mutex_key key_LOCK_wsrep_desync;
 
 PSI_mutex_key key_LOCK_wsrep_group_commit;
+PSI_mutex_key key_LOCK_wsrep_sync_wait;
 PSI_mutex_key key_LOCK_wsrep_SR_pool;
 PSI_mutex_key key_LOCK_wsrep_SR_store;
 
@@ -12761,6 +12769,7 @@ static PSI_mutex_info all_server_mutexes[]=
   { &key_LOCK_wsrep_desync, "LOCK_wsrep_desync", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
 
   { &key_LOCK_wsrep_group_commit, "LOCK_wsrep_group_commit", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
+  { &key_LOCK_wsrep_sync_wait, "LOCK_wsrep_sync_wait", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_LOCK_wsrep_SR_pool, "LOCK_wsrep_SR_pool", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_LOCK_wsrep_SR_store, "LOCK_wsrep_SR_store", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
 
@@ -12848,6 +12857,7 @@ PSI_cond_key key_COND_wsrep_sst_thread;
 
 PSI_cond_key key_COND_wsrep_thd_queue;
 PSI_cond_key key_COND_wsrep_group_commit;
+PSI_cond_key key_COND_wsrep_sync_wait;
 #endif /* WITH_WSREP */
 
 PSI_cond_key key_RELAYLOG_update_cond;
@@ -12912,7 +12922,8 @@ static PSI_cond_info all_server_conds[]=
   { &key_COND_wsrep_sst_thread, "COND_wsrep_sst_thread", 0, 0, PSI_DOCUMENT_ME},
 
   { &key_COND_wsrep_thd_queue, "COND_wsrep_thd_queue", 0, 0, PSI_DOCUMENT_ME},
-  { &key_COND_wsrep_group_commit, "COND_wsrep_group_commit", 0, 0, PSI_DOCUMENT_ME}
+  { &key_COND_wsrep_group_commit, "COND_wsrep_group_commit", 0, 0, PSI_DOCUMENT_ME},
+  { &key_COND_wsrep_sync_wait, "COND_wsrep_sync_wait", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME}
 #endif /* WITH_WSREP */
 };
 /* clang-format on */
@@ -13162,6 +13173,13 @@ PSI_stage_info stage_wsrep_replicating_commit = {
 PSI_stage_info stage_wsrep_write_set_replicated = {
     0, "wsrep: write-set replicated and certified", 0, PSI_DOCUMENT_ME};
 
+PSI_stage_info stage_wsrep_preparing_commit = {
+    0, "wsrep: preparing to commit write set", 0, PSI_DOCUMENT_ME};
+PSI_stage_info stage_wsrep_waiting_for_commit_order = {
+    0, "wsrep: waiting for commit order", 0, PSI_DOCUMENT_ME};
+PSI_stage_info stage_wsrep_waiting_for_causal_read = {
+    0, "wsrep: waiting for causal read", 0, PSI_DOCUMENT_ME};
+
 PSI_stage_info stage_wsrep_replaying_trx = {0, "wsrep: replaying transaction",
                                             0, PSI_DOCUMENT_ME};
 PSI_stage_info stage_wsrep_replayed_write_set = {0, "wsrep: replayed write set",
@@ -13307,6 +13325,10 @@ PSI_stage_info *wsrep_server_stages[] = {
     &stage_wsrep_replicating_commit,
     &stage_wsrep_write_set_replicated,
 
+    &stage_wsrep_preparing_commit,
+    &stage_wsrep_waiting_for_commit_order,
+    &stage_wsrep_waiting_for_causal_read,
+
     &stage_wsrep_replaying_trx,
     &stage_wsrep_replayed_write_set,
 
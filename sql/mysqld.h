@@ -687,6 +687,10 @@ extern PSI_stage_info stage_wsrep_rolled_back;
 extern PSI_stage_info stage_wsrep_replicating_commit;
 extern PSI_stage_info stage_wsrep_write_set_replicated;
 
+extern PSI_stage_info stage_wsrep_preparing_commit;
+extern PSI_stage_info stage_wsrep_waiting_for_commit_order;
+extern PSI_stage_info stage_wsrep_waiting_for_causal_read;
+
 extern PSI_stage_info stage_wsrep_replaying_trx;
 extern PSI_stage_info stage_wsrep_replayed_write_set;
 
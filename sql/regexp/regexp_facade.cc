@@ -251,10 +251,19 @@ bool Regexp_facade::SetupEngine(Item *pattern_expr, uint flags) {
     return false;
   }
 
+  /*
+    A pattern that is not constant often evaluates to the same string for
+    many rows, so keep the compiled regular expression in that case.
+  */
+  if (m_engine != nullptr && !m_engine->IsError() &&
+      flags == m_engine->flags() && pattern == m_current_pattern)
+    return false;
+
   // Actually compile the regular expression.
   m_engine = make_unique_destroy_only<Regexp_engine>(
       *THR_MALLOC, pattern, flags, opt_regexp_stack_limit,
       opt_regexp_time_limit);
+  m_current_pattern = std::move(pattern);
 
   // If something went wrong, an error was raised.
   return m_engine->IsError();
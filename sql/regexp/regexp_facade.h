@@ -191,6 +191,12 @@ class Regexp_facade {
     @see Regexp_engine::reset()
   */
   std::u16string m_current_subject;
+
+  /**
+    The pattern that m_engine was compiled from, used to avoid recompiling
+    a pattern that is not constant when it evaluates to the same string.
+  */
+  std::u16string m_current_pattern;
 };
 
 }  // namespace regexp
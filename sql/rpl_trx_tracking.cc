@@ -288,12 +288,44 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
     }
   }
 
-  if (exceeds_capacity || !can_use_writesets) {
+  if (!can_use_writesets) {
     m_writeset_history_start = sequence_number;
     m_writeset_history.clear();
+  } else if (exceeds_capacity) {
+    prune_history(sequence_number, *writeset);
   }
 }
 
+void Writeset_trx_dependency_tracker::prune_history(
+    int64 sequence_number, const std::vector<uint64> &writeset) {
+  /*
+    Forget the rows whose last change is older than the middle of the tracked
+    range, rather than the whole history. A later transaction touching one of
+    them still gets a commit parent no older than that point, since
+    m_writeset_history_start is moved there, so it cannot run ahead of the
+    forgotten change.
+  */
+  const int64 cutoff = m_writeset_history_start +
+                       (sequence_number - m_writeset_history_start) / 2;
+
+  for (auto it = m_writeset_history.begin(); it != m_writeset_history.end();) {
+    if (it->second < cutoff)
+      it = m_writeset_history.erase(it);
+    else
+      ++it;
+  }
+  m_writeset_history_start = cutoff;
+
+  if (m_writeset_history.size() + writeset.size() > m_opt_max_history_size) {
+    m_writeset_history_start = sequence_number;
+    m_writeset_history.clear();
+    return;
+  }
+
+  /* The rows of this transaction were not added while the history was full. */
+  for (uint64 hash : writeset) m_writeset_history[hash] = sequence_number;
+}
+
 void Writeset_trx_dependency_tracker::rotate(int64 start) {
   m_writeset_history_start = start;
   m_writeset_history.clear();
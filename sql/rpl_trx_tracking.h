@@ -26,6 +26,7 @@
 #include <sys/types.h>
 #include <atomic>
 #include <map>
+#include <vector>
 
 #include "libbinlogevents/include/binlog_event.h"
 #include "my_dbug.h"
@@ -157,6 +158,16 @@ class Writeset_trx_dependency_tracker {
   */
   typedef std::map<uint64, int64> Writeset_history;
   Writeset_history m_writeset_history;
+
+  /**
+    Make room in a full history by dropping its older half, falling back to
+    clearing it if the current transaction still does not fit.
+
+    @param sequence_number sequence_number of the current transaction.
+    @param writeset        row hashes of the current transaction.
+  */
+  void prune_history(int64 sequence_number,
+                     const std::vector<uint64> &writeset);
 };
 
 /**
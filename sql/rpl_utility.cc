@@ -33,6 +33,7 @@
 #include "my_byteorder.h"
 #include "my_dbug.h"
 #include "my_loglevel.h"
+#include "my_pointer_arithmetic.h"
 #include "my_sys.h"
 #include "mysql/components/services/log_builtins.h"
 #include "mysql/service_mysql_alloc.h"
@@ -880,11 +881,8 @@ table_def::~table_def() {
 void hash_slave_rows_free_entry::operator()(HASH_ROW_ENTRY *entry) const {
   DBUG_TRACE;
   if (entry) {
-    if (entry->preamble) {
-      entry->preamble->~HASH_ROW_PREAMBLE();
-      my_free(entry->preamble);
-    }
-    if (entry->positions) my_free(entry->positions);
+    /* The preamble and positions live in the same block as the entry. */
+    entry->preamble->~HASH_ROW_PREAMBLE();
     my_free(entry);
   }
 }
@@ -913,14 +911,24 @@ HASH_ROW_ENTRY *Hash_slave_rows::make_entry(const uchar *bi_start,
                                             const uchar *bi_ends) {
   DBUG_TRACE;
 
-  HASH_ROW_ENTRY *entry = (HASH_ROW_ENTRY *)my_malloc(
-      key_memory_HASH_ROW_ENTRY, sizeof(HASH_ROW_ENTRY), MYF(0));
-  HASH_ROW_PREAMBLE *preamble = (HASH_ROW_PREAMBLE *)my_malloc(
-      key_memory_HASH_ROW_ENTRY, sizeof(HASH_ROW_PREAMBLE), MYF(0));
-  HASH_ROW_POS *pos = (HASH_ROW_POS *)my_malloc(key_memory_HASH_ROW_ENTRY,
-                                                sizeof(HASH_ROW_POS), MYF(0));
+  /*
+    One entry is made per row of the event, so the entry, its preamble and
+    its positions share a single allocation.
+  */
+  const size_t preamble_offset = ALIGN_SIZE(sizeof(HASH_ROW_ENTRY));
+  const size_t pos_offset =
+      preamble_offset + ALIGN_SIZE(sizeof(HASH_ROW_PREAMBLE));
+  uchar *block = (uchar *)my_malloc(key_memory_HASH_ROW_ENTRY,
+                                    pos_offset + sizeof(HASH_ROW_POS), MYF(0));
+
+  if (!block) {
+    DBUG_PRINT("info", ("Hash_slave_rows::make_entry - malloc error"));
+    return nullptr;
+  }
 
-  if (!entry || !preamble || !pos) goto err;
+  HASH_ROW_ENTRY *entry = (HASH_ROW_ENTRY *)block;
+  HASH_ROW_PREAMBLE *preamble = (HASH_ROW_PREAMBLE *)(block + preamble_offset);
+  HASH_ROW_POS *pos = (HASH_ROW_POS *)(block + pos_offset);
 
   /**
      Filling in the preamble.
@@ -943,16 +951,6 @@ HASH_ROW_ENTRY *Hash_slave_rows::make_entry(const uchar *bi_start,
   entry->positions = pos;
 
   return entry;
-
-err:
-  DBUG_PRINT("info", ("Hash_slave_rows::make_entry - malloc error"));
-  if (entry) my_free(entry);
-  if (preamble) {
-    preamble->~HASH_ROW_PREAMBLE();
-    my_free(preamble);
-  }
-  if (pos) my_free(pos);
-  return nullptr;
 }
 
 bool Hash_slave_rows::put(TABLE *table, MY_BITMAP *cols,
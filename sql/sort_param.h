@@ -444,7 +444,8 @@ class Sort_param {
   enum enum_sort_algorithm {
     FILESORT_ALG_NONE,
     FILESORT_ALG_STD_SORT,
-    FILESORT_ALG_STD_STABLE
+    FILESORT_ALG_STD_STABLE,
+    FILESORT_ALG_RADIX
   };
   enum_sort_algorithm m_sort_algorithm{FILESORT_ALG_NONE};
 
@@ -485,6 +485,8 @@ THD::THD(bool enable_plugins)
       run_wsrep_commit_hooks(false),
       run_wsrep_ordered_commit(false),
       wsrep_enforce_group_commit(false),
+      wsrep_sync_wait_shared(false),
+      wsrep_auto_streaming(false),
       wsrep_post_insert_error(false),
       wsrep_stmt_transaction_rolled_back(false),
       wsrep_force_savept_rollback(false),
@@ -948,6 +950,8 @@ void THD::init(void) {
   run_wsrep_commit_hooks = false;
   run_wsrep_ordered_commit = false;
   wsrep_enforce_group_commit = false;
+  wsrep_sync_wait_shared = false;
+  wsrep_auto_streaming = false;
   wsrep_post_insert_error = false;
   wsrep_stmt_transaction_rolled_back = false;
   wsrep_force_savept_rollback = false;
@@ -3057,6 +3057,21 @@ class THD : public MDL_context_owner,
   */
   bool wsrep_enforce_group_commit;
 
+  /**
+    Set when the causal wait of the current statement was satisfied by a
+    sync wait round trip shared with other sessions (see wsrep_sync_wait()).
+    Plays the role of wsrep_cs().sync_wait_gtid() for such statements and is
+    cleared together with it at the end of the statement.
+  */
+  bool wsrep_sync_wait_shared;
+
+  /**
+    Set when streaming replication was enabled for the current transaction
+    because its write set grew past wsrep_trx_auto_fragment_size. Streaming
+    is disabled again once the transaction ends.
+  */
+  bool wsrep_auto_streaming;
+
   /**
     Set to true if there is error post insert action.
     for example: say trigger action.
@@ -7362,6 +7362,7 @@ static void wsrep_prepare_for_autocommit_retry(THD *thd, const char *rawbuf,
   /* Ensure the gtid is resetted on query retry so retry attempt operates
   with same flow as normal attempt waiting for sync_wait if needed. */
   thd->wsrep_cs().reset_sync_wait_gtid();
+  thd->wsrep_sync_wait_shared = false;
   thd->wsrep_retry_counter++;  // grow
   wsrep_copy_query(thd);
   thd->set_time();
@@ -8071,6 +8071,15 @@ static Sys_var_ulonglong Sys_wsrep_trx_fragment_size(
     NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(wsrep_trx_fragment_size_check),
     ON_UPDATE(wsrep_trx_fragment_size_update));
 
+static Sys_var_ulong Sys_wsrep_trx_auto_fragment_size(
+    "wsrep_trx_auto_fragment_size",
+    "When non-zero, a local transaction that has not enabled streaming "
+    "replication is switched to streaming with fragments of this many bytes "
+    "once its write set grows past this size",
+    GLOBAL_VAR(wsrep_trx_auto_fragment_size), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, WSREP_MAX_WS_SIZE), DEFAULT(0), BLOCK_SIZE(1),
+    NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0), ON_UPDATE(0));
+
 extern const char *wsrep_fragment_units[];
 
 static Sys_var_enum Sys_wsrep_trx_fragment_unit(
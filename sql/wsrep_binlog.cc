@@ -47,51 +47,64 @@ int wsrep_write_cache_buf(IO_CACHE_binlog_cache_storage *cache, uchar **buf,
                           size_t *buf_len) {
   my_off_t const saved_pos(cache->position());
 
-  unsigned char *read_pos = NULL;
-  my_off_t read_len = 0;
-
-  if (cache->begin(&read_pos, &read_len)) {
-    WSREP_ERROR("Failed to initialize io-cache");
-    return ER_ERROR_ON_WRITE;
-  }
+  /*
+    The cache is still in write mode here, so its position is the amount of
+    data it holds. Size the destination buffer once up front instead of
+    growing it segment by segment: with a large cache spilled to the
+    temporary file every my_realloc() may move the whole buffer again.
+  */
+  size_t const total_length = *buf_len + saved_pos;
 
-  if (read_len == 0 && cache->next(&read_pos, &read_len)) {
-    WSREP_ERROR("Failed to read from io-cache");
-    return ER_ERROR_ON_WRITE;
+  /*
+    Bail out if buffer grows too large.
+    A temporary fix to avoid allocating indefinitely large buffer,
+    not a real limit on a writeset size which includes other things
+    like header and keys.
+  */
+  if (total_length > wsrep_max_ws_size) {
+    WSREP_WARN("Transaction/Write-set size limit (%lu) exceeded: %zu",
+               wsrep_max_ws_size, total_length);
+    goto cleanup;
   }
 
-  size_t total_length = *buf_len;
+  {
+    unsigned char *read_pos = NULL;
+    my_off_t read_len = 0;
 
-  while (read_len > 0) {
-    total_length += read_len;
+    if (cache->begin(&read_pos, &read_len)) {
+      WSREP_ERROR("Failed to initialize io-cache");
+      return ER_ERROR_ON_WRITE;
+    }
 
-    /*
-      Bail out if buffer grows too large.
-      A temporary fix to avoid allocating indefinitely large buffer,
-      not a real limit on a writeset size which includes other things
-      like header and keys.
-    */
-    if (total_length > wsrep_max_ws_size) {
-      WSREP_WARN("Transaction/Write-set size limit (%lu) exceeded: %zu",
-                 wsrep_max_ws_size, total_length);
-      goto error;
+    if (read_len == 0 && cache->next(&read_pos, &read_len)) {
+      WSREP_ERROR("Failed to read from io-cache");
+      return ER_ERROR_ON_WRITE;
     }
 
-    uchar *tmp =
-        (uchar *)my_realloc(key_memory_wsrep, *buf, total_length, MYF(0));
-    if (!tmp) {
-      WSREP_ERROR(
-          "Fail to allocate/reallocate memory to hold"
-          " write-set for replication."
-          " Existing Size: %zu, Requested Size: %lu",
-          *buf_len, (long unsigned)total_length);
-      goto error;
+    if (total_length > *buf_len) {
+      uchar *tmp =
+          (uchar *)my_realloc(key_memory_wsrep, *buf, total_length, MYF(0));
+      if (!tmp) {
+        WSREP_ERROR(
+            "Fail to allocate/reallocate memory to hold"
+            " write-set for replication."
+            " Existing Size: %zu, Requested Size: %lu",
+            *buf_len, (long unsigned)total_length);
+        goto error;
+      }
+      *buf = tmp;
     }
-    *buf = tmp;
 
-    memcpy(*buf + *buf_len, read_pos, read_len);
-    *buf_len = total_length;
-    cache->next(&read_pos, &read_len);
+    while (read_len > 0) {
+      if (unlikely(*buf_len + read_len > total_length)) {
+        WSREP_ERROR("io-cache returned more data than it holds: %zu > %zu",
+                    (size_t)(*buf_len + read_len), total_length);
+        goto error;
+      }
+      memcpy(*buf + *buf_len, read_pos, read_len);
+      *buf_len += read_len;
+      cache->next(&read_pos, &read_len);
+    }
   }
 
   if (cache->truncate(saved_pos)) {
@@ -27,6 +27,7 @@
 
   This function quite the same as MYSQL_BIN_LOG::write_cache(),
   with the exception that here we write in buffer instead of log file.
+  The buffer is grown once to the final size before copying.
  */
 int wsrep_write_cache_buf(IO_CACHE_binlog_cache_storage *cache, uchar **buf,
                           size_t *buf_len);
@@ -645,6 +645,15 @@ void Wsrep_applier_service::after_apply() {
 }
 
 bool Wsrep_applier_service::check_exit_status() const {
+  /*
+    This is called by every applier after every write set. Avoid taking
+    the global LOCK_wsrep_slave_threads unless some appliers have actually
+    been scheduled for closure, the mutex would otherwise serialize all
+    appliers on each apply/commit.
+  */
+  if (wsrep_slave_count_change.load(std::memory_order_relaxed) >= 0)
+    return false;
+
   bool ret = false;
   mysql_mutex_lock(&LOCK_wsrep_slave_threads);
   if (wsrep_slave_count_change < 0) {
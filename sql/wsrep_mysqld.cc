@@ -86,13 +86,14 @@ const char *wsrep_data_home_dir = NULL;
 const char *wsrep_dbug_option = "";
 uint wsrep_min_log_verbosity = 3;
 long wsrep_slave_threads = 1;           // # of slave action appliers wanted
-int wsrep_slave_count_change = 0;       // # of appliers to stop or start
+std::atomic<int> wsrep_slave_count_change{0};  // # of appliers to stop/start
 ulong wsrep_debug = 0;                  // enable debug level logging
 ulong wsrep_retry_autocommit = 5;       // retry aborted autocommit trx
 bool wsrep_auto_increment_control = 1;  // control auto increment variables
 bool wsrep_incremental_data_collection = 0;  // incremental data collection
 ulong wsrep_max_ws_size = 1073741824UL;      // max ws (RBR buffer) size
 ulong wsrep_max_ws_rows = 65536;             // max number of rows in ws
+ulong wsrep_trx_auto_fragment_size = 0;      // auto streaming threshold
 int wsrep_to_isolation = 0;                  // # of active TO isolation threads
 bool wsrep_certify_nonPK = 1;  // certify, even when no primary key
 ulong wsrep_certification_rules = WSREP_CERTIFICATION_RULES_STRICT;
@@ -1337,11 +1338,90 @@ bool wsrep_must_sync_wait(THD *thd, uint mask) {
           !is_update_query(thd->lex->sql_command)) &&
         !thd->in_active_multi_stmt_transaction() &&
         thd->wsrep_trx().state() != wsrep::transaction::s_replaying &&
-        thd->wsrep_cs().sync_wait_gtid().is_undefined();
+        thd->wsrep_cs().sync_wait_gtid().is_undefined() &&
+        !thd->wsrep_sync_wait_shared;
   mysql_mutex_unlock(&thd->LOCK_wsrep_thd);
   return ret;
 }
 
+/*
+  Sync wait rounds shared between sessions. Any round that is started after
+  a session entered wsrep_sync_wait() observes every write set that was
+  committed anywhere in the cluster before that moment, so a single
+  causal read serves all sessions that queued up while the previous round
+  was in flight. Protected by LOCK_wsrep_sync_wait.
+*/
+static ulonglong wsrep_sync_wait_started = 0;
+static ulonglong wsrep_sync_wait_completed = 0;
+static bool wsrep_sync_wait_in_flight = false;
+static enum wsrep::client_error wsrep_sync_wait_last_error = wsrep::e_success;
+
+/**
+  Wait until this node has caught up with the cluster, sharing the round
+  trip with concurrent callers.
+
+  The first session to arrive while no round is in flight becomes the leader
+  and waits through its own client state. Sessions arriving meanwhile wait
+  for the next round to complete and take over its outcome. A session that
+  arrives while a round is in flight cannot use that round, so it waits for
+  at most two rounds. The wait can be interrupted with KILL.
+
+  @param      thd    session that needs the causal read
+  @param[out] error  the error of the round on failure
+
+  @return 0 on success, non-zero on failure or when thd was killed
+*/
+static int wsrep_sync_wait_group(THD *thd, enum wsrep::client_error *error) {
+  PSI_stage_info old_stage;
+  bool waiting = false;
+
+  *error = wsrep::e_success;
+  mysql_mutex_lock(&LOCK_wsrep_sync_wait);
+  const ulonglong round = wsrep_sync_wait_started + 1;
+  while (wsrep_sync_wait_completed < round) {
+    if (!wsrep_sync_wait_in_flight) {
+      const ulonglong mine = ++wsrep_sync_wait_started;
+      wsrep_sync_wait_in_flight = true;
+      mysql_mutex_unlock(&LOCK_wsrep_sync_wait);
+      if (waiting) thd->EXIT_COND(&old_stage);
+
+      const int ret = thd->wsrep_cs().sync_wait(-1);
+      if (ret) *error = thd->wsrep_cs().current_error();
+
+      mysql_mutex_lock(&LOCK_wsrep_sync_wait);
+      wsrep_sync_wait_in_flight = false;
+      wsrep_sync_wait_completed = mine;
+      wsrep_sync_wait_last_error = *error;
+      mysql_cond_broadcast(&COND_wsrep_sync_wait);
+      mysql_mutex_unlock(&LOCK_wsrep_sync_wait);
+      return ret;
+    }
+
+    if (!waiting) {
+      thd->ENTER_COND(&COND_wsrep_sync_wait, &LOCK_wsrep_sync_wait,
+                      &stage_wsrep_waiting_for_causal_read, &old_stage);
+      waiting = true;
+    }
+    struct timespec abstime;
+    set_timespec(&abstime, 1);
+    mysql_cond_timedwait(&COND_wsrep_sync_wait, &LOCK_wsrep_sync_wait,
+                         &abstime);
+    if (thd->killed) {
+      mysql_mutex_unlock(&LOCK_wsrep_sync_wait);
+      thd->EXIT_COND(&old_stage);
+      return 1;
+    }
+  }
+  *error = wsrep_sync_wait_last_error;
+  mysql_mutex_unlock(&LOCK_wsrep_sync_wait);
+  if (waiting) thd->EXIT_COND(&old_stage);
+
+  if (*error != wsrep::e_success) return 1;
+
+  thd->wsrep_sync_wait_shared = true;
+  return 0;
+}
+
 bool wsrep_sync_wait(THD *thd, uint mask) {
   if (wsrep_must_sync_wait(thd, mask)) {
     WSREP_DEBUG(
@@ -1353,10 +1433,16 @@ bool wsrep_sync_wait(THD *thd, uint mask) {
       This allows autocommit SELECTs and a first SELECT after SET AUTOCOMMIT=0
       TODO: modify to check if thd has locked any rows.
     */
-    if (thd->wsrep_cs().sync_wait(-1)) {
+    enum wsrep::client_error error;
+    if (wsrep_sync_wait_group(thd, &error)) {
       const char *msg;
       int err;
 
+      if (thd->killed) {
+        thd->send_kill_message();
+        return true;
+      }
+
       /*
         Possibly relevant error codes:
         ER_CHECKREAD, ER_ERROR_ON_READ, ER_INVALID_DEFAULT, ER_EMPTY_QUERY,
@@ -1364,7 +1450,7 @@ bool wsrep_sync_wait(THD *thd, uint mask) {
         ER_FEATURE_DISABLED, ER_QUERY_INTERRUPTED
       */
 
-      switch (thd->wsrep_cs().current_error()) {
+      switch (error) {
         case wsrep::e_not_supported_error:
           msg =
               "synchronous reads by wsrep backend. "
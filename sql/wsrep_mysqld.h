@@ -18,6 +18,7 @@
 
 #include <mysql/plugin.h>
 
+#include <atomic>
 #include <vector>
 #include "mysqld.h"
 #include "rpl_gtid.h"
@@ -64,7 +65,7 @@ extern const char *wsrep_node_incoming_address;
 extern const char *wsrep_data_home_dir;
 extern const char *wsrep_dbug_option;
 extern long wsrep_slave_threads;
-extern int wsrep_slave_count_change;
+extern std::atomic<int> wsrep_slave_count_change;
 extern MYSQL_PLUGIN_IMPORT ulong wsrep_debug;
 extern ulong wsrep_retry_autocommit;
 extern bool wsrep_auto_increment_control;
@@ -72,6 +73,7 @@ extern bool wsrep_incremental_data_collection;
 extern const char *wsrep_start_position;
 extern ulong wsrep_max_ws_size;
 extern ulong wsrep_max_ws_rows;
+extern ulong wsrep_trx_auto_fragment_size;
 extern const char *wsrep_notify_cmd;
 extern bool wsrep_certify_nonPK;
 extern long wsrep_protocol_version;
@@ -378,6 +380,8 @@ extern mysql_mutex_t LOCK_wsrep_cluster_config;
 extern mysql_mutex_t LOCK_wsrep_desync;
 extern mysql_mutex_t LOCK_wsrep_group_commit;
 extern mysql_cond_t COND_wsrep_group_commit;
+extern mysql_mutex_t LOCK_wsrep_sync_wait;
+extern mysql_cond_t COND_wsrep_sync_wait;
 extern mysql_mutex_t LOCK_wsrep_SR_pool;
 extern mysql_mutex_t LOCK_wsrep_SR_store;
 extern mysql_mutex_t LOCK_wsrep_alter_tablespace;
@@ -405,6 +409,8 @@ extern PSI_mutex_key key_LOCK_wsrep_cluster_config;
 extern PSI_mutex_key key_LOCK_wsrep_desync;
 extern PSI_mutex_key key_LOCK_wsrep_group_commit;
 extern PSI_cond_key key_COND_wsrep_group_commit;
+extern PSI_mutex_key key_LOCK_wsrep_sync_wait;
+extern PSI_cond_key key_COND_wsrep_sync_wait;
 extern PSI_mutex_key key_LOCK_wsrep_SR_pool;
 extern PSI_mutex_key key_LOCK_wsrep_SR_store;
 
@@ -898,46 +898,42 @@ int Wsrep_schema::update_fragment_meta(THD *thd,
   DBUG_RETURN(ret);
 }
 
+/*
+  Remove a single fragment. The caller must have initialized the primary
+  key for index access and stored the server id and transaction id into
+  frag_table->record[0], only the seqno changes between fragments.
+*/
 static int remove_fragment(THD *thd, TABLE *frag_table,
-                           const wsrep::id &server_id,
                            wsrep::transaction_id transaction_id,
                            wsrep::seqno seqno) {
   WSREP_DEBUG("remove_fragment(%u) trx %llu, seqno %lld", thd->thread_id(),
               transaction_id.get(), seqno.get());
-  int ret = 0;
   int error;
   uchar key[MAX_KEY_LENGTH];
   key_part_map key_map = 0;
 
-  DBUG_ASSERT(server_id.is_undefined() == false);
-  DBUG_ASSERT(transaction_id.is_undefined() == false);
   DBUG_ASSERT(seqno.is_undefined() == false);
 
   /*
     Remove record with the given uuid, trx id, and seqno.
     Using a complete key here avoids gap locks.
   */
-  Wsrep_schema_impl::store(frag_table, 0, server_id);
-  Wsrep_schema_impl::store(frag_table, 1, transaction_id.get());
   Wsrep_schema_impl::store(frag_table, 2, seqno.get());
   Wsrep_schema_impl::make_key(frag_table, key, &key_map, 3);
 
-  if ((error =
-           Wsrep_schema_impl::init_for_index_scan(frag_table, key, key_map))) {
+  if ((error = frag_table->file->ha_index_read_map(
+           frag_table->record[0], key, key_map, HA_READ_KEY_EXACT))) {
     if (error == HA_ERR_END_OF_FILE || error == HA_ERR_KEY_NOT_FOUND) {
       WSREP_DEBUG("Record not found in %s.%s:trx %llu, seqno %lld, error %d",
                   frag_table->s->db.str, frag_table->s->table_name.str,
                   transaction_id.get(), seqno.get(), error);
+    } else {
+      WSREP_ERROR("Failed to read fragment for removal, error %d", error);
     }
-    ret = error;
-  } else {
-    if (Wsrep_schema_impl::delete_row(frag_table)) {
-      ret = 1;
-    }
-    Wsrep_schema_impl::end_index_scan(frag_table);
+    return error;
   }
 
-  return ret;
+  return Wsrep_schema_impl::delete_row(frag_table);
 }
 
 int Wsrep_schema::remove_fragments(THD *thd, const wsrep::id &server_id,
@@ -970,13 +966,34 @@ int Wsrep_schema::remove_fragments(THD *thd, const wsrep::id &server_id,
     WSREP_DEBUG("Failed to open SR table for access");
     ret = 1;
   } else {
-    tables.table->use_all_columns();
-    for (std::vector<wsrep::seqno>::const_iterator i = fragments.begin();
-         i != fragments.end(); ++i) {
-      if (remove_fragment(thd, tables.table, server_id, transaction_id, *i)) {
-        ret = 1;
-        break;
+    TABLE *frag_table = tables.table;
+    frag_table->use_all_columns();
+
+    DBUG_ASSERT(server_id.is_undefined() == false);
+    DBUG_ASSERT(transaction_id.is_undefined() == false);
+
+    /*
+      All fragments of the transaction share the server id and transaction
+      id key prefix, so store it once and keep the index open for the whole
+      batch instead of initializing it for every fragment.
+    */
+    Wsrep_schema_impl::store(frag_table, 0, server_id);
+    Wsrep_schema_impl::store(frag_table, 1, transaction_id.get());
+
+    int error;
+    if ((error = frag_table->file->ha_index_init(frag_table->s->primary_key,
+                                                 true))) {
+      WSREP_ERROR("Failed to init table for index scan: %d", error);
+      ret = 1;
+    } else {
+      for (std::vector<wsrep::seqno>::const_iterator i = fragments.begin();
+           i != fragments.end(); ++i) {
+        if (remove_fragment(thd, frag_table, transaction_id, *i)) {
+          ret = 1;
+          break;
+        }
       }
+      if (Wsrep_schema_impl::end_index_scan(frag_table)) ret = 1;
     }
   }
   close_thread_tables(thd);
@@ -16,10 +16,12 @@
 #include "wsrep_sst.h"
 #include <cstdio>
 #include <cstdlib>
+#include <netdb.h>  // getaddrinfo()
 #include <regex>
 #include <sstream>
 #include "debug_sync.h"
 #include "log_event.h"
+#include "my_hostname.h"  // HOSTNAME_LENGTH
 #include "my_rnd.h"
 #include "mysql/components/services/log_builtins.h"
 #include "mysql_version.h"
@@ -73,6 +75,7 @@ extern const char wsrep_defaults_group_suffix[];
 #define WSREP_SST_SKIP "skip"
 #define WSREP_SST_XTRABACKUP "xtrabackup"
 #define WSREP_SST_XTRABACKUP_V2 "xtrabackup-v2"
+#define WSREP_SST_CLONE "clone"
 #define WSREP_SST_DEFAULT WSREP_SST_XTRABACKUP_V2
 #define WSREP_SST_ADDRESS_AUTO "AUTO"
 
@@ -98,7 +101,8 @@ bool wsrep_sst_method_check(sys_var *, THD *, set_var *var) {
     return true;
   }
 
-  if (strcmp(var->save_result.string_value.str, WSREP_SST_XTRABACKUP_V2) != 0) {
+  if (strcmp(var->save_result.string_value.str, WSREP_SST_XTRABACKUP_V2) &&
+      strcmp(var->save_result.string_value.str, WSREP_SST_CLONE)) {
     my_error(ER_WRONG_VALUE_FOR_VAR, MYF(0), var->var->name.str,
              var->save_result.string_value.str
                  ? var->save_result.string_value.str
@@ -271,12 +275,14 @@ struct sst_thread_arg {
   char **env;
   char *ret_str;
   int err;
+  /* joiner host if the donor has to serve a clone plugin recipient */
+  const char *clone_host;
 
   mysql_mutex_t LOCK_wsrep_sst_thread;
   mysql_cond_t COND_wsrep_sst_thread;
 
-  sst_thread_arg(const char *c, char **e)
-      : cmd(c), env(e), ret_str(0), err(-1) {
+  sst_thread_arg(const char *c, char **e, const char *ch = nullptr)
+      : cmd(c), env(e), ret_str(0), err(-1), clone_host(ch) {
     mysql_mutex_init(key_LOCK_wsrep_sst_thread, &LOCK_wsrep_sst_thread,
                      MY_MUTEX_INIT_FAST);
     mysql_cond_init(key_COND_wsrep_sst_thread, &COND_wsrep_sst_thread);
@@ -1109,7 +1115,22 @@ static uint server_session_execute(MYSQL_SESSION session, std::string query,
   return err;
 }
 
-static int wsrep_create_sst_user(bool initialize_thread, const char *password) {
+/**
+  Create the account used by the donor SST script.
+
+  @param initialize_thread  initialize the server session thread
+  @param password           password of the SST account
+  @param clone_host         for the SST method "clone": the joiner host, the
+                            network account used by its clone plugin
+                            recipient is created for this host only
+  @param clone_password     password of the clone account
+  @param[out] clone_installed  set if the clone plugin was installed here
+                            and has to be uninstalled after the SST
+*/
+static int wsrep_create_sst_user(bool initialize_thread, const char *password,
+                                 const char *clone_host,
+                                 const char *clone_password,
+                                 bool *clone_installed) {
   int err = 0;
   int const auth_len = 512;
   char auth_buf[auth_len];
@@ -1135,6 +1156,21 @@ static int wsrep_create_sst_user(bool initialize_thread, const char *password) {
     nullptr
   };
 
+  // Extra commands for the clone SST method, same layout as above.
+  // The arguments are the joiner host and the clone password.
+  const char *clone_cmds[] = {
+    "DROP USER IF EXISTS 'mysql.pxc.sst.clone'@'%s';",
+    nullptr,
+    "CREATE USER 'mysql.pxc.sst.clone'@'%s' IDENTIFIED BY '%s';",
+    "CREATE USER mysql.pxc.sst.clone IDENTIFIED BY *",
+    "GRANT BACKUP_ADMIN ON *.* TO 'mysql.pxc.sst.clone'@'%s';",
+    nullptr,
+    nullptr,
+    nullptr
+  };
+
+  *clone_installed = false;
+
   wsrep_allow_server_session = true;
   session = setup_server_session(initialize_thread);
   if (!session) {
@@ -1154,6 +1190,33 @@ static int wsrep_create_sst_user(bool initialize_thread, const char *password) {
     err = server_session_execute(session, auth_buf, cmds[index + 1], true);
   }
 
+  if (clone_host && !err) {
+    // The plugin may already be loaded (by INSTALL PLUGIN or --plugin-load),
+    // it is left in place then. Otherwise the installation is recorded in
+    // mysql.plugin, so it is undone by wsrep_remove_sst_user().
+    err = server_session_execute(
+        session, "INSTALL PLUGIN clone SONAME 'mysql_clone.so';", nullptr,
+        true);
+    if (err == ER_UDF_EXISTS)
+      err = 0;
+    else if (!err)
+      *clone_installed = true;
+    else
+      WSREP_ERROR("Failed to install the clone plugin: %d", err);
+  }
+
+  for (int index = 0; clone_host && !err && clone_cmds[index]; index += 2) {
+    int ret;
+    ret = snprintf(auth_buf, auth_len, clone_cmds[index], clone_host,
+                   clone_password);
+    if (ret < 0 || ret >= auth_len) {
+      WSREP_ERROR("wsrep_create_sst_user() : snprintf() failed: %d", ret);
+      err = (ret < 0 ? ret : -EMSGSIZE);
+      break;
+    }
+    err = server_session_execute(session, auth_buf, clone_cmds[index + 1]);
+  }
+
   // Overwrite query (clear out any sensitive data)
   ::memset(auth_buf, 0, auth_len);
 
@@ -1162,8 +1225,11 @@ static int wsrep_create_sst_user(bool initialize_thread, const char *password) {
   return err;
 }
 
-int wsrep_remove_sst_user(bool initialize_thread) {
+int wsrep_remove_sst_user(bool initialize_thread, const char *clone_host,
+                          bool clone_installed) {
   int err = 0;
+  int const auth_len = 512;
+  char auth_buf[auth_len];
   MYSQL_SESSION session = NULL;
 
   // Skip the attempt to  mysql.pxc.sst.user in case the server was started with
@@ -1197,6 +1263,26 @@ int wsrep_remove_sst_user(bool initialize_thread) {
     err = server_session_execute(session, cmds[index], cmds[index + 1], true);
   }
 
+  if (clone_host) {
+    int ret = snprintf(auth_buf, auth_len,
+                       "DROP USER IF EXISTS 'mysql.pxc.sst.clone'@'%s';",
+                       clone_host);
+    if (ret < 0 || ret >= auth_len) {
+      WSREP_ERROR("wsrep_remove_sst_user() : snprintf() failed: %d", ret);
+      err = (ret < 0 ? ret : -EMSGSIZE);
+    } else {
+      ret = server_session_execute(session, auth_buf, nullptr);
+      if (!err) err = ret;
+    }
+  }
+
+  // Leave the server with the plugin set it had before the SST
+  if (clone_installed) {
+    int ret = server_session_execute(session, "UNINSTALL PLUGIN clone;",
+                                     nullptr);
+    if (!err) err = ret;
+  }
+
   cleanup_server_session(session, initialize_thread);
   wsrep_allow_server_session = false;
   return err;
@@ -1222,6 +1308,16 @@ static void *sst_donor_thread(void *a) {
   std::string password;
   generate_password(&password, 32);
 
+  // The clone account is reachable over the network, it gets a password
+  // of its own and is limited to the joiner host
+  std::string clone_host;
+  std::string clone_password;
+  bool clone_installed = false;
+  if (arg->clone_host) {
+    clone_host.assign(arg->clone_host);
+    generate_password(&clone_password, 32);
+  }
+
   wsrep_uuid_t ret_uuid = WSREP_UUID_UNDEFINED;
   wsrep_seqno_t ret_seqno = WSREP_SEQNO_UNDEFINED;  // seqno of complete SST
 
@@ -1229,9 +1325,15 @@ static void *sst_donor_thread(void *a) {
                         // operate with wsrep_ready == OFF
 
   // Create the SST auth user
-  err = wsrep_create_sst_user(true, password.c_str());
+  err = wsrep_create_sst_user(
+      true, password.c_str(), arg->clone_host ? clone_host.c_str() : nullptr,
+      clone_password.c_str(), &clone_installed);
 
   if (err) {
+    // Do not leave a half created clone account or the plugin behind
+    if (arg->clone_host)
+      wsrep_remove_sst_user(true, clone_host.c_str(), clone_installed);
+
 #ifdef HAVE_PSI_INTERFACE
     wsrep_pfs_delete_thread();
 #endif /* HAVE_PSI_INTERFACE */
@@ -1262,6 +1364,9 @@ static void *sst_donor_thread(void *a) {
                   "sst_user=mysql.pxc.sst.user\n"
                   "sst_password=%s\n",
                   password.c_str());
+    if (ret >= 0 && arg->clone_host)
+      ret = fprintf(proc.write_pipe(), "sst_clone_password=%s\n",
+                    clone_password.c_str());
     if (ret < 0) {
       WSREP_ERROR("sst_donor_thread(): fprintf() failed: %d", ret);
       err = (ret < 0 ? ret : -EMSGSIZE);
@@ -1271,6 +1376,7 @@ static void *sst_donor_thread(void *a) {
     proc.close_write_pipe();
   }
   password.assign(password.length(), 0);  // overwrite password value
+  clone_password.assign(clone_password.length(), 0);
 
   sst_process = &proc;
   mysql_mutex_unlock(&LOCK_wsrep_sst);
@@ -1346,7 +1452,8 @@ static void *sst_donor_thread(void *a) {
                 strerror(err));
   }
 
-  wsrep_remove_sst_user(true);
+  wsrep_remove_sst_user(true, clone_host.empty() ? nullptr : clone_host.c_str(),
+                        clone_installed);
 
   if (locked)  // don't forget to unlock server before return
   {
@@ -1372,6 +1479,63 @@ static void *sst_donor_thread(void *a) {
   return NULL;
 }
 
+/*
+  Host of the clone account for the SST address "host:port/path" or
+  "[ipv6]:port/path" sent by the joiner.
+
+  The address comes from the network and ends up in account management
+  statements, so only host name and IP address characters are accepted.
+  A host name is resolved to its numeric address: accounts for an IP match
+  regardless of skip_name_resolve and of reverse DNS.
+
+  @param      addr  SST address of the joiner
+  @param[out] host  numeric address of the joiner
+
+  @return true if the address is valid and could be resolved
+*/
+static bool sst_clone_account_host(const char *addr, std::string *host) {
+  std::string name(addr);
+  if (name[0] == '[')
+    name = name.substr(1, name.find(']') - 1);
+  else
+    name = name.substr(0, name.find_first_of(":/"));
+
+  static const std::regex host_regex("[A-Za-z0-9.-]+|[0-9A-Fa-f:.]+");
+  if (name.empty() || name.length() > static_cast<size_t>(HOSTNAME_LENGTH) ||
+      !std::regex_match(name, host_regex)) {
+    WSREP_ERROR("Invalid joiner host for the clone SST: '%s'", addr);
+    return false;
+  }
+
+  struct addrinfo *res, hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_family = AF_UNSPEC;
+
+  int gai_ret = getaddrinfo(name.c_str(), NULL, &hints, &res);
+  if (gai_ret) {
+    WSREP_ERROR("getaddrinfo() failed on '%s': %d (%s)", name.c_str(),
+                gai_ret, gai_strerror(gai_ret));
+    return false;
+  }
+  char buf[NI_MAXHOST];
+  gai_ret = getnameinfo(res->ai_addr, res->ai_addrlen, buf, sizeof(buf),
+                        NULL, 0, NI_NUMERICHOST);
+  freeaddrinfo(res);
+  if (gai_ret) {
+    WSREP_ERROR("getnameinfo() failed on '%s': %d (%s)", name.c_str(),
+                gai_ret, gai_strerror(gai_ret));
+    return false;
+  }
+
+  // Drop an IPv6 scope id, '%' is a wildcard in account names
+  host->assign(buf, strcspn(buf, "%"));
+  if (*host != name)
+    WSREP_INFO("Clone SST account host '%s' resolved to %s", name.c_str(),
+               buf);
+  return true;
+}
+
 static int sst_donate_other(const char *method, const char *addr,
                             const wsrep::gtid &gtid, bool bypass,
                             char **env)  // carries auth info
@@ -1429,10 +1593,15 @@ static int sst_donate_other(const char *method, const char *addr,
     return (ret < 0 ? ret : -EMSGSIZE);
   }
 
+  // The clone recipient connects from the joiner host
+  std::string clone_host;
+  const bool clone = !bypass && !strcmp(method, WSREP_SST_CLONE);
+  if (clone && !sst_clone_account_host(addr, &clone_host)) return -EINVAL;
+
   if (!bypass && wsrep_sst_donor_rejects_queries) sst_reject_queries(false);
 
   pthread_t tmp;
-  sst_thread_arg arg(cmd_str(), env);
+  sst_thread_arg arg(cmd_str(), env, clone ? clone_host.c_str() : nullptr);
   mysql_mutex_lock(&arg.LOCK_wsrep_sst_thread);
   ret = pthread_create(&tmp, NULL, sst_donor_thread, &arg);
   if (ret) {
@@ -54,6 +54,8 @@ std::string wsrep_sst_prepare();
 int wsrep_sst_donate(const std::string &request, const wsrep::gtid &gtid,
                      bool bypass);
 
-extern int wsrep_remove_sst_user(bool initialize_thread);
+extern int wsrep_remove_sst_user(bool initialize_thread,
+                                 const char *clone_host = nullptr,
+                                 bool clone_installed = false);
 
 #endif /* WSREP_SST_H */
@@ -134,6 +134,28 @@ static inline int wsrep_start_trx_if_not_started(THD *thd) {
   return ret;
 }
 
+/*
+  Switch the transaction to streaming replication once its write set
+  grows past wsrep_trx_auto_fragment_size bytes.
+ */
+static inline void wsrep_auto_enable_streaming(THD *thd) {
+  const size_t threshold = wsrep_trx_auto_fragment_size;
+  if (threshold == 0 || wsrep_protocol_version < 4) return;
+
+  IO_CACHE_binlog_cache_storage *cache = wsrep_get_trans_cache(thd, true);
+  if (cache == nullptr || cache->position() < threshold) return;
+
+  if (!wsrep_provider_is_SR_capable()) return;
+
+  WSREP_DEBUG("Enabling streaming for transaction %llu: write set size %llu",
+              (ulonglong)thd->wsrep_trx().id().get(),
+              (ulonglong)cache->position());
+  if (thd->wsrep_cs().enable_streaming(wsrep::streaming_context::bytes,
+                                       threshold) == 0) {
+    thd->wsrep_auto_streaming = true;
+  }
+}
+
 /*
   Called after each row operation.
 
@@ -144,7 +166,11 @@ static inline int wsrep_after_row(THD *thd, bool) {
       wsrep_thd_is_local(thd)) {
     if (wsrep_check_pk(thd)) {
       return 1;
-    } else if (wsrep_streaming_enabled(thd)) {
+    }
+    if (!wsrep_streaming_enabled(thd)) {
+      wsrep_auto_enable_streaming(thd);
+    }
+    if (wsrep_streaming_enabled(thd)) {
       return thd->wsrep_cs().after_row();
     }
   }
@@ -230,7 +256,7 @@ static inline int wsrep_before_prepare(THD *thd, bool all) {
     WSREP_DEBUG("%s", thd->wsrep_info);
     thd_proc_info(thd, thd->wsrep_info);
   } else {
-    THD_STAGE_INFO(thd, stage_wsrep_replicating_commit);
+    THD_STAGE_INFO(thd, stage_wsrep_preparing_commit);
     snprintf(thd->wsrep_info, sizeof(thd->wsrep_info),
              "wsrep: preparing to commit write set(%lld)",
              (long long)wsrep_thd_trx_seqno(thd));
@@ -289,7 +315,19 @@ static inline int wsrep_before_commit(THD *thd, bool all) {
               (long long)wsrep_thd_trx_seqno(thd));
   int ret = 0;
   DBUG_ASSERT(wsrep_run_commit_hook(thd, all));
-  if ((ret = thd->wsrep_cs().before_commit()) == 0) {
+  if (wsrep_thd_is_applying(thd)) {
+    /* Appliers enter commit order in before_commit(), time spent waiting
+    for preceding write sets to commit is accounted to this stage. Local
+    clients replicate and certify there instead, so they keep their stage. */
+    PSI_stage_info old_stage;
+    thd->enter_stage(&stage_wsrep_waiting_for_commit_order, &old_stage,
+                     __func__, __FILE__, __LINE__);
+    ret = thd->wsrep_cs().before_commit();
+    THD_STAGE_INFO(thd, old_stage);
+  } else {
+    ret = thd->wsrep_cs().before_commit();
+  }
+  if (ret == 0) {
     DBUG_ASSERT(!thd->wsrep_trx().ws_meta().gtid().is_undefined());
 #if 0
     wsrep_xid_init(&thd->wsrep_xid, thd->wsrep_trx().ws_meta().gtid());
@@ -451,9 +489,19 @@ static inline int wsrep_before_statement(THD *thd) {
 static inline int wsrep_after_statement(THD *thd) {
   DBUG_ENTER("wsrep_after_statement");
   // WSREP_DEBUG("wsrep_after_statement %u", thd->thread_id());
-  DBUG_RETURN(thd->wsrep_cs().state() != wsrep::client_state::s_none
-                  ? thd->wsrep_cs().after_statement()
-                  : 0);
+  thd->wsrep_sync_wait_shared = false;
+  int ret = (thd->wsrep_cs().state() != wsrep::client_state::s_none
+                 ? thd->wsrep_cs().after_statement()
+                 : 0);
+  if (thd->wsrep_auto_streaming && !thd->wsrep_trx().active() &&
+      thd->wsrep_cs().state() == wsrep::client_state::s_exec) {
+    /* Transaction which was switched to streaming has ended */
+    thd->wsrep_auto_streaming = false;
+    if (!thd->variables.wsrep_trx_fragment_size) {
+      thd->wsrep_cs().disable_streaming();
+    }
+  }
+  DBUG_RETURN(ret);
 }
 
 static inline void wsrep_after_apply(THD *thd) {
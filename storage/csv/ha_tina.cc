@@ -449,10 +449,11 @@ static my_off_t find_eoln_buff(Transparent_file *data_buff, my_off_t begin,
   *eoln_len = 0;
 
   for (my_off_t x = begin; x < end; x++) {
+    const char c = data_buff->get_value(x);
     /* Unix (includes Mac OS X) */
-    if (data_buff->get_value(x) == '\n')
+    if (c == '\n')
       *eoln_len = 1;
-    else if (data_buff->get_value(x) == '\r')  // Mac or Dos
+    else if (c == '\r')  // Mac or Dos
     {
       /* old Mac line ending */
       if (x + 1 == end || (data_buff->get_value(x + 1) != '\n'))
@@ -39,6 +39,9 @@ class Transparent_file {
   my_off_t upper_bound;
   uint buff_size;
 
+  /* Refill the window starting at offset and return the byte there */
+  char read_value(my_off_t offset);
+
  public:
   Transparent_file();
   ~Transparent_file();
@@ -47,6 +50,11 @@ class Transparent_file {
   uchar *ptr();
   my_off_t start();
   my_off_t end();
-  char get_value(my_off_t offset);
+  char get_value(my_off_t offset) {
+    /* check boundaries */
+    if ((lower_bound <= offset) && (offset < upper_bound))
+      return buff[offset - lower_bound];
+    return read_value(offset);
+  }
   my_off_t read_next();
 };
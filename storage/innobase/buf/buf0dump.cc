@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <stdarg.h>
 #include <stdio.h>
 #include <algorithm>
+#include <vector>
 
 #include "buf0buf.h"
 #include "buf0dump.h"
@@ -426,6 +427,52 @@ void buf_load_throttle_if_needed(ib_time_monotonic_ms_t *last_check_time,
   *last_activity_count = srv_get_activity_count();
 }
 
+/** Number of hotness tiers the loaded pages are split into. buf_dump() writes
+each buffer pool instance's LRU list starting from the most recently used end,
+so the position of a page among the pages of its instance tells how hot it
+was. Pages are read tier by tier, hottest first, and sorted by (space, page)
+within a tier so that the reads stay mostly sequential. */
+static const ulint BUF_LOAD_TIERS = 8;
+
+/** Sort the pages read from the dump file so that the hottest part of every
+buffer pool instance is loaded first, keeping (space, page) order inside each
+tier.
+@param[in,out]	dump	pages in the order they were dumped
+@param[in]	dump_n	number of elements in dump */
+static void buf_load_sort(buf_dump_t *dump, ulint dump_n) {
+  using Counts = std::vector<ulint, ut_allocator<ulint>>;
+  using Tiered = std::pair<ulint, buf_dump_t>;
+  using Pages = std::vector<Tiered, ut_allocator<Tiered>>;
+
+  Counts total(srv_buf_pool_instances, 0);
+  Counts seen(srv_buf_pool_instances, 0);
+
+  auto instance = [](buf_dump_t entry) {
+    const page_id_t page_id(BUF_DUMP_SPACE(entry), BUF_DUMP_PAGE(entry));
+    return buf_pool_index(buf_pool_get(page_id));
+  };
+
+  for (ulint i = 0; i < dump_n; i++) {
+    ++total[instance(dump[i])];
+  }
+
+  Pages pages;
+  pages.reserve(dump_n);
+
+  for (ulint i = 0; i < dump_n; i++) {
+    const ulint inst = instance(dump[i]);
+    const ulint tier = seen[inst]++ * BUF_LOAD_TIERS / total[inst];
+
+    pages.emplace_back(tier, dump[i]);
+  }
+
+  std::sort(pages.begin(), pages.end());
+
+  for (ulint i = 0; i < dump_n; i++) {
+    dump[i] = pages[i].second;
+  }
+}
+
 /** Perform a buffer pool load from the file specified by
  innodb_buffer_pool_filename. If any errors occur then the value of
  innodb_buffer_pool_load_status will be set accordingly, see buf_load_status().
@@ -563,15 +610,15 @@ static void buf_load() {
   }
 
   if (!SHUTTING_DOWN()) {
-    std::sort(dump, dump + dump_n);
+    buf_load_sort(dump, dump_n);
   }
 
   ib_time_monotonic_ms_t last_check_time = 0;
   ulint last_activity_cnt = 0;
 
   /* Avoid calling the expensive fil_space_acquire_silent() for each
-  page within the same tablespace. dump[] is sorted by (space, page),
-  so all pages from a given tablespace are consecutive. */
+  page within the same tablespace. Within a tier dump[] is sorted by
+  (space, page), so pages from a given tablespace are mostly consecutive. */
   space_id_t cur_space_id = BUF_DUMP_SPACE(dump[0]);
   fil_space_t *space = fil_space_acquire_silent(cur_space_id);
   page_size_t page_size(space ? space->flags : 0);
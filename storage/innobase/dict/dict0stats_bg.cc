@@ -159,6 +159,20 @@ static bool dict_stats_recalc_pool_get(
   return (true);
 }
 
+/** Get the number of tables waiting in the auto recalc pool.
+@return number of table ids in the pool */
+static ulint dict_stats_recalc_pool_len() {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&recalc_pool_mutex);
+
+  const ulint len = recalc_pool->size();
+
+  mutex_exit(&recalc_pool_mutex);
+
+  return (len);
+}
+
 /** Delete a given table from the auto recalc pool.
  dict_stats_recalc_pool_del() */
 void dict_stats_recalc_pool_del(
@@ -380,7 +394,20 @@ void dict_stats_thread() {
       break;
     }
 
-    dict_stats_process_entry_from_recalc_pool(thd);
+    /* Process every table that is queued now before going back to sleep,
+    otherwise a burst of enqueued tables would be handled at one table per
+    MIN_RECALC_INTERVAL. Tables put back on the list because they were
+    recalculated recently are not seen again until the next round. */
+    for (ulint n = dict_stats_recalc_pool_len(); n > 0 && !SHUTTING_DOWN();
+         --n) {
+#ifdef UNIV_DEBUG
+      if (innodb_dict_stats_disabled_debug) {
+        break;
+      }
+#endif /* UNIV_DEBUG */
+
+      dict_stats_process_entry_from_recalc_pool(thd);
+    }
 
     os_event_reset(dict_stats_event);
   }
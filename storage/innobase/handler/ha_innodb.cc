@@ -8468,11 +8468,15 @@ uint wsrep_store_key_val_for_row(THD *thd, TABLE *table, uint keynr, char *buff,
 
   DBUG_ENTER("wsrep_store_key_val_for_row");
 
-  memset(buff, 0, buff_len);
+  /* The buffer is not cleared up front: it is as large as the longest
+  supported key and this is called for every key of every modified row.
+  Every byte up to the returned length is either written or explicitly
+  zeroed below. */
   *key_is_null = true;
 
   for (; key_part != end; key_part++) {
-    uchar sorted[REC_VERSION_56_MAX_INDEX_COL_LEN] = {'\0'};
+    /* Only the first true_len bytes (as returned by the sort) are used */
+    uchar sorted[REC_VERSION_56_MAX_INDEX_COL_LEN];
     ibool part_is_null = FALSE;
 
     if (key_part->null_bit) {
@@ -8514,6 +8518,7 @@ uint wsrep_store_key_val_for_row(THD *thd, TABLE *table, uint keynr, char *buff,
           fprintf(stderr, "WSREP: key truncated: %s\n", wsrep_thd_query(thd));
           true_len = buff_space;
         }
+        memset(buff, 0, true_len);
         buff += true_len;
         buff_space -= true_len;
         continue;
@@ -8563,6 +8568,7 @@ uint wsrep_store_key_val_for_row(THD *thd, TABLE *table, uint keynr, char *buff,
         buff += true_len;
         buff_space -= true_len;
       } else {
+        memset(buff, 0, std::min(key_len, (ulint)buff_space));
         buff += key_len;
       }
     } else if (mysql_type == MYSQL_TYPE_TINY_BLOB ||
@@ -8589,6 +8595,7 @@ uint wsrep_store_key_val_for_row(THD *thd, TABLE *table, uint keynr, char *buff,
           fprintf(stderr, "WSREP: key truncated: %s\n", wsrep_thd_query(thd));
           true_len = buff_space;
         }
+        memset(buff, 0, true_len);
         buff += true_len;
         buff_space -= true_len;
 
@@ -8658,6 +8665,7 @@ uint wsrep_store_key_val_for_row(THD *thd, TABLE *table, uint keynr, char *buff,
           fprintf(stderr, "WSREP: key truncated: %s\n", wsrep_thd_query(thd));
           true_len = buff_space;
         }
+        memset(buff, 0, true_len);
         buff += true_len;
         buff_space -= true_len;
 
@@ -12750,7 +12758,8 @@ int ha_innobase::wsrep_append_keys(
 
   if (wsrep_protocol_version == 0) {
     uint len;
-    char keyval[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1] = {'\0'};
+    /* filled in by wsrep_store_key_val_for_row() */
+    char keyval[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1];
     char *key = &keyval[0];
     ibool is_null;
 
@@ -12778,6 +12787,9 @@ int ha_innobase::wsrep_append_keys(
       }
     }
 
+    const bool referenced_by_fk =
+        dict_table_is_referenced_by_foreign_key(m_prebuilt->table);
+
     for (i = 0; i < table->s->keys; ++i) {
       KEY *key_info = table->key_info + i;
 
@@ -12786,9 +12798,11 @@ int ha_innobase::wsrep_append_keys(
 
       /* keyval[] shall contain an ordinal number at byte 0
          and the actual key data shall be written at byte 1.
-         Hence the total data length is the key length + 1 */
-      char keyval0[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1] = {'\0'};
-      char keyval1[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1] = {'\0'};
+         Hence the total data length is the key length + 1.
+         The key data is filled in by wsrep_store_key_val_for_row(),
+         so the buffers are deliberately left uninitialized. */
+      char keyval0[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1];
+      char keyval1[WSREP_MAX_SUPPORTED_KEY_LENGTH + 1];
       keyval0[0] = (char)i;
       keyval1[0] = (char)i;
       char *key0 = &keyval0[1];
@@ -12799,9 +12813,6 @@ int ha_innobase::wsrep_append_keys(
                    key_info->name);
       }
 
-      const bool referenced_by_fk =
-          dict_table_is_referenced_by_foreign_key(m_prebuilt->table);
-
       /* !hasPK == table with no PK,
          must append all non-unique keys */
       if ((!hasPK && wsrep_certify_nonPK) || key_info->flags & HA_NOSAME ||
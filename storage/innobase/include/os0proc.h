@@ -48,6 +48,10 @@ typedef unsigned long int os_process_id_t;
 system with os_mem_alloc_large(). */
 extern std::atomic<ulint> os_total_large_mem_allocated;
 
+/** Number of os_mem_alloc_large() calls that could not get large pages
+although they were requested, and fell back to conventional memory. */
+extern std::atomic<ulint> os_large_page_fallbacks;
+
 /** Whether to use large pages in the buffer pool */
 extern bool os_use_large_pages;
 
@@ -35,6 +35,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 #define srv0mon_h
 
 #include "univ.i"
+#include "ut0cpu_cache.h"
 
 #ifndef __STDC_LIMIT_MACROS
 /* Required for FreeBSD so that INT64_MAX is defined. */
@@ -160,6 +161,7 @@ enum monitor_id_t {
   MONITOR_OVLD_ROW_LOCK_WAIT,
   MONITOR_OVLD_LOCK_AVG_WAIT_TIME,
   MONITOR_SCHEDULE_REFRESHES,
+  MONITOR_SCHEDULE_REFRESH_MICROSECOND,
 
   /* Buffer and I/O realted counters. */
   MONITOR_MODULE_BUFFER,
@@ -598,8 +600,9 @@ counter option. */
    ((ulint)1 << (monitor % NUM_BITS_ULINT)))
 
 /** The actual monitor counter array that records each monintor counter
-value */
-extern monitor_value_t innodb_counter_value[NUM_MONITOR];
+value. Counters are updated from many threads, so the elements are padded to
+keep updates of one counter from invalidating its neighbours. */
+extern ut::Cacheline_padded<monitor_value_t> innodb_counter_value[NUM_MONITOR];
 
 /** Following are macro defines for basic montior counter manipulations.
 Please note we do not provide any synchronization for these monitor
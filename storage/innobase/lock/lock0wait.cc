@@ -1553,6 +1553,7 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
   bottleneck, one can check if declaring this vectors as static solves the
   issue.
   */
+  const auto counter_time = ut_time_monotonic_us();
   ut::vector<waiting_trx_info_t> infos;
   ut::vector<int> outgoing;
   ut::vector<trx_schedule_weight_t> new_weights;
@@ -1568,6 +1569,9 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
     /* This will also update trx->lock.schedule_weight for trxs on cycles. */
     lock_wait_find_and_handle_deadlocks(infos, outgoing, new_weights);
   }
+
+  MONITOR_INC_TIME_IN_MICRO_SECS(MONITOR_SCHEDULE_REFRESH_MICROSECOND,
+                                 counter_time);
 }
 
 /** A thread which wakes up threads whose lock wait may have lasted too long,
@@ -89,6 +89,13 @@ this must be less than UNIV_PAGE_SIZE as it is stored in the buffer pool */
 /** Read-ahead area in applying log records to file pages */
 static const size_t RECV_READ_AHEAD_AREA = 32;
 
+/** Interval in microseconds at which the recovery thread polls for the
+I/O threads to finish applying a batch. A batch ends only when the last
+page read completes, so a coarse interval idles the recovery thread for
+up to that long on every batch of a redo log larger than the buffer pool
+can hold. */
+static const ulint RECV_APPLY_WAIT_INTERVAL = 10000;
+
 /** The recovery system */
 recv_sys_t *recv_sys = nullptr;
 
@@ -1173,7 +1180,7 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
 
     if (abort) return;
 
-    os_thread_sleep(500000);
+    os_thread_sleep(RECV_APPLY_WAIT_INTERVAL);
   }
 
   if (!allow_ibuf) {
@@ -1255,7 +1262,7 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
       return;
     }
 
-    os_thread_sleep(500000);
+    os_thread_sleep(RECV_APPLY_WAIT_INTERVAL);
 
     mutex_enter(&recv_sys->mutex);
   }
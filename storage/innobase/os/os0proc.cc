@@ -75,6 +75,10 @@ extern bool wsrep_recovery;
 system with os_mem_alloc_large(). */
 std::atomic<ulint> os_total_large_mem_allocated{0};
 
+/** Number of os_mem_alloc_large() calls that could not get large pages
+although they were requested, and fell back to conventional memory. */
+std::atomic<ulint> os_large_page_fallbacks{0};
+
 /** Whether to use large pages in the buffer pool */
 bool os_use_large_pages;
 
@@ -103,6 +107,28 @@ ulint os_proc_get_number(void) {
 #endif
 }
 
+#if defined HAVE_LINUX_LARGE_PAGES && defined UNIV_LINUX && \
+    defined MADV_HUGEPAGE
+/** Size of a transparent huge page.
+@return the PMD huge page size reported by the kernel, 0 if unknown */
+static ulint os_thp_size() {
+  static const ulint thp_size = []() {
+    ulint value = 0;
+    FILE *file =
+        fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (file != nullptr) {
+      unsigned long size;
+      if (fscanf(file, "%lu", &size) == 1 && ut_is_2pow(size)) {
+        value = size;
+      }
+      fclose(file);
+    }
+    return value;
+  }();
+  return thp_size;
+}
+#endif /* HAVE_LINUX_LARGE_PAGES && UNIV_LINUX && MADV_HUGEPAGE */
+
 /** Allocates large pages memory.
 @param[in,out]	n	Number of bytes to allocate
 @return allocated memory */
@@ -113,7 +139,14 @@ void *os_mem_alloc_large(ulint *n, bool populate) {
   int shmid;
   struct shmid_ds buf;
 
-  if (!os_use_large_pages || !os_large_page_size) {
+  if (!os_use_large_pages) {
+    goto skip;
+  }
+
+  if (!os_large_page_size) {
+    /* No hugetlb page size is known, the request can only be served
+    from conventional memory. */
+    os_large_page_fallbacks.fetch_add(1);
     goto skip;
   }
 
@@ -150,6 +183,7 @@ void *os_mem_alloc_large(ulint *n, bool populate) {
   }
 
   ib::warn(ER_IB_MSG_854) << "Using conventional memory pool";
+  os_large_page_fallbacks.fetch_add(1);
 skip:
 #endif /* HAVE_LINUX_LARGE_PAGES && UNIV_LINUX */
 
@@ -174,23 +208,82 @@ skip:
     UNIV_MEM_ALLOC(ptr, size);
   }
 #else
-  size = getpagesize();
+  const ulint page_size = getpagesize();
   /* Align block size to system page size */
-  ut_ad(ut_is_2pow(size));
-  size = *n = ut_2pow_round(*n + (size - 1), size);
-  ptr =
-      mmap(nullptr, size, PROT_READ | PROT_WRITE,
-           MAP_PRIVATE | OS_MAP_ANON | (populate ? OS_MAP_POPULATE : 0), -1, 0);
+  ut_ad(ut_is_2pow(page_size));
+  size = *n = ut_2pow_round(*n + (page_size - 1), page_size);
+
+  /* Alignment of the mapping if it is stricter than the page size */
+  ulint align = 0;
+  bool thp = false;
+
+#if defined HAVE_LINUX_LARGE_PAGES && defined UNIV_LINUX && \
+    defined MADV_HUGEPAGE
+  /* Large pages were asked for but the region is conventional memory,
+  either because no hugetlb pages were available or no large page size is
+  known. Let transparent huge pages back it where the kernel allows, so
+  that buffer pool chunks added by an online resize get the same TLB
+  benefit as the ones allocated at startup. Huge pages only back aligned,
+  not yet faulted in ranges: map the region aligned to the huge page size
+  and without MAP_POPULATE, and pre-fault it after madvise(). */
+  if (os_use_large_pages) {
+    thp = true;
+    const ulint thp_size = os_thp_size();
+    if (thp_size > page_size && size >= thp_size) {
+      align = thp_size;
+      size = *n = ut_2pow_round(size + (thp_size - 1), thp_size);
+    }
+  }
+#endif /* HAVE_LINUX_LARGE_PAGES && UNIV_LINUX && MADV_HUGEPAGE */
+
+  const ulint map_size = align ? size + align - page_size : size;
+  ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | OS_MAP_ANON |
+                 (populate && !thp ? OS_MAP_POPULATE : 0),
+             -1, 0);
   if (UNIV_UNLIKELY(ptr == (void *)-1)) {
-    ib::error(ER_IB_MSG_856) << "mmap(" << size
+    ib::error(ER_IB_MSG_856) << "mmap(" << map_size
                              << " bytes) failed;"
                                 " errno "
                              << errno;
     return nullptr;
-  } else {
-    os_total_large_mem_allocated.fetch_add(size);
-    UNIV_MEM_ALLOC(ptr, size);
   }
+
+  if (align) {
+    /* Unmap the unaligned head and the tail of the mapping */
+    byte *start = static_cast<byte *>(ptr);
+    byte *aligned = static_cast<byte *>(ut_align(start, align));
+    byte *end = start + map_size;
+
+    if (aligned > start) {
+      munmap(start, aligned - start);
+    }
+    if (aligned + size < end) {
+      munmap(aligned + size, end - (aligned + size));
+    }
+    ptr = aligned;
+  }
+
+  os_total_large_mem_allocated.fetch_add(size);
+  UNIV_MEM_ALLOC(ptr, size);
+
+#if defined HAVE_LINUX_LARGE_PAGES && defined UNIV_LINUX && \
+    defined MADV_HUGEPAGE
+  if (thp) {
+    if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+      ib::info() << "madvise(MADV_HUGEPAGE) failed; errno " << errno;
+    }
+
+    if (populate) {
+      /* Pre-fault the region now that the advice is in place */
+#ifdef MADV_POPULATE_WRITE
+      if (madvise(ptr, size, MADV_POPULATE_WRITE) != 0)
+#endif /* MADV_POPULATE_WRITE */
+        memset(ptr, '\0', size);
+      populate = false;
+    }
+  }
+#endif /* HAVE_LINUX_LARGE_PAGES && UNIV_LINUX && MADV_HUGEPAGE */
 #endif
 
 #if defined(WITH_WSREP) && defined(UNIV_LINUX)
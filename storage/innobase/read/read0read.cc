@@ -381,6 +381,9 @@ void ReadView::copy_trx_ids(const trx_ids_t &trx_ids) {
     return;
   }
 
+  /* The old contents are overwritten below, clear the array first so that
+  reserve() does not copy them across while we hold trx_sys->mutex. */
+  m_ids.clear();
   m_ids.reserve(size);
   m_ids.resize(size);
 
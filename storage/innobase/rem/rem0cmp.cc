@@ -448,6 +448,28 @@ inline int cmp_data(ulint mtype, ulint prtype, bool is_asc, const byte *data1,
                               data2, (unsigned)len2));
   }
 
+  /* Values of INT, BIGINT and BINARY(16) keys have the same length on both
+  sides. Compare such values as big-endian words instead of byte by byte. */
+  if (len1 == len2 && (len1 == 4 || len1 == 8 || len1 == 16)) {
+    int cmp = 0;
+
+    if (len1 == 4) {
+      const uint32_t a = mach_read_from_4(data1);
+      const uint32_t b = mach_read_from_4(data2);
+
+      cmp = (a > b) - (a < b);
+    } else {
+      for (ulint i = 0; cmp == 0 && i < len1; i += 8) {
+        const uint64_t a = mach_read_from_8(data1 + i);
+        const uint64_t b = mach_read_from_8(data2 + i);
+
+        cmp = (a > b) - (a < b);
+      }
+    }
+
+    return (is_asc ? cmp : -cmp);
+  }
+
   ulint len;
 
   if (len1 < len2) {
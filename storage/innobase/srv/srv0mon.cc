@@ -213,6 +213,12 @@ static monitor_info_t innodb_counter_info[] = {
      "weights of transactions",
      MONITOR_DEFAULT_ON, MONITOR_DEFAULT_START, MONITOR_SCHEDULE_REFRESHES},
 
+    {"lock_schedule_refresh_usec", "lock",
+     "Time (in microseconds) spent analyzing the wait-for graph to update "
+     "schedule weights and search for deadlocks",
+     MONITOR_NONE, MONITOR_DEFAULT_START,
+     MONITOR_SCHEDULE_REFRESH_MICROSECOND},
+
     /* ========== Counters for Buffer Manager and I/O ========== */
     {"module_buffer", "buffer", "Buffer Manager Module", MONITOR_MODULE,
      MONITOR_DEFAULT_START, MONITOR_MODULE_BUFFER},
@@ -1457,7 +1463,7 @@ static monitor_info_t innodb_counter_info[] = {
 };
 
 /* The "innodb_counter_value" array stores actual counter values */
-monitor_value_t innodb_counter_value[NUM_MONITOR];
+ut::Cacheline_padded<monitor_value_t> innodb_counter_value[NUM_MONITOR];
 
 /* monitor_set_tbl is used to record and determine whether a monitor
 has been turned on/off. */
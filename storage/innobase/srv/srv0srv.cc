@@ -1557,6 +1557,11 @@ bool srv_printf_innodb_monitor(FILE *file, bool nowait, ulint *trx_start_pos,
           "Dictionary memory allocated " ULINTPF "\n",
           os_total_large_mem_allocated.load(), dict_sys ? dict_sys->size : 0UL);
 
+  if (os_use_large_pages) {
+    fprintf(file, "Large page allocations fallen back " ULINTPF "\n",
+            os_large_page_fallbacks.load());
+  }
+
   buf_print_io(file);
 
   fputs(
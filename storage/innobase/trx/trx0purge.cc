@@ -2168,23 +2168,49 @@ static ulint trx_purge_attach_undo_recs(const ulint n_purge_threads,
   batch are handled by the same thread. Ths is to avoid contention
   on the dict_index_t::lock */
 
-  GroupBy::const_iterator end = group_by.cend();
+  /* Hand out the tables largest first, each to the thread with the
+  fewest records so far. Assigning them round-robin in table id order
+  could stack a hot table with others on one thread while the remaining
+  threads finish early and wait for the batch. */
+  using Group = purge_node_t::Recs *;
+  std::vector<Group, mem_heap_allocator<Group>> groups{
+      mem_heap_allocator<Group>{heap}};
 
-  for (GroupBy::const_iterator it = group_by.cbegin(); it != end;) {
-    for (ulint i = 0; i < n_purge_threads && it != end; ++i, ++it) {
-      purge_node_t *node;
+  groups.reserve(group_by.size());
 
-      node = static_cast<purge_node_t *>(run_thrs[i]->child);
+  for (auto &entry : group_by) {
+    groups.push_back(entry.second);
+  }
 
-      ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
+  std::stable_sort(groups.begin(), groups.end(),
+                   [](const Group lhs, const Group rhs) {
+                     return lhs->size() > rhs->size();
+                   });
 
-      if (node->recs == nullptr) {
-        node->recs = it->second;
-      } else {
-        for (auto iter = it->second->begin(); iter != it->second->end();
-             ++iter) {
-          node->recs->push_back(*iter);
-        }
+  ulint n_recs[MAX_PURGE_THREADS] = {};
+
+  for (auto recs : groups) {
+    ulint least = 0;
+
+    for (ulint i = 1; i < n_purge_threads; ++i) {
+      if (n_recs[i] < n_recs[least]) {
+        least = i;
+      }
+    }
+
+    n_recs[least] += recs->size();
+
+    purge_node_t *node;
+
+    node = static_cast<purge_node_t *>(run_thrs[least]->child);
+
+    ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
+
+    if (node->recs == nullptr) {
+      node->recs = recs;
+    } else {
+      for (auto iter = recs->begin(); iter != recs->end(); ++iter) {
+        node->recs->push_back(*iter);
       }
     }
   }
@@ -1090,11 +1090,11 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
 
   static std::atomic<ulint> rseg_counter{0};
   trx_rseg_t *rseg = nullptr;
-  ulint current = rseg_counter;
-
   /* Increment the static redo_rseg_slot so the next call from any thread
-  starts with the next rseg. */
-  rseg_counter.fetch_add(1);
+  starts with the next rseg. Read and increment in one step, otherwise
+  concurrent callers can start from the same slot and pile up on the
+  same rseg->mutex. */
+  ulint current = rseg_counter.fetch_add(1);
 
   while (rseg == nullptr) {
     /* Traverse the rsegs like this: (space, rseg_id)
@@ -165,6 +165,40 @@ static int rdb_i_s_cfstats_fill_table(
         DBUG_RETURN(ret);
       }
     }
+
+    // Write stall counters of this CF, the same ones SHOW STATUS reports
+    // as rocksdb_stall_* summed over all column families.
+    std::map<std::string, std::string> props;
+    if (!rdb->GetMapProperty(cfh.get(), "rocksdb.cfstats", &props)) {
+      continue;
+    }
+
+    const std::string prop_name_prefix = "io_stalls.";
+    for (const auto &prop_ent : props) {
+      const std::string &prop_name = prop_ent.first;
+      if (prop_name.find(prop_name_prefix) != 0) {
+        continue;
+      }
+
+      std::string stat_type =
+          "IO_STALLS_" + prop_name.substr(prop_name_prefix.size());
+      std::transform(stat_type.begin(), stat_type.end(), stat_type.begin(),
+                     ::toupper);
+
+      tables->table->field[RDB_CFSTATS_FIELD::CF_NAME]->store(
+          cf_name.c_str(), cf_name.size(), system_charset_info);
+      tables->table->field[RDB_CFSTATS_FIELD::STAT_TYPE]->store(
+          stat_type.c_str(), stat_type.size(), system_charset_info);
+      tables->table->field[RDB_CFSTATS_FIELD::VALUE]->store(
+          std::stoull(prop_ent.second), true);
+
+      ret = static_cast<int>(
+          my_core::schema_table_store_record(thd, tables->table));
+
+      if (ret) {
+        DBUG_RETURN(ret);
+      }
+    }
   }
 
   DBUG_RETURN(0);
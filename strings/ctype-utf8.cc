@@ -5683,6 +5683,14 @@ static size_t my_well_formed_len_utf8(const CHARSET_INFO *, const char *b,
                                       const char *e, size_t pos, int *error) {
   const char *b_start = b;
   *error = 0;
+  // Fast path as long as we see ASCII characters only.
+  while (pos >= 8 && e - b >= 8) {
+    uint64_t data;
+    memcpy(&data, b, sizeof(data));
+    if (data & 0x8080808080808080ULL) break;
+    b += sizeof(data);
+    pos -= sizeof(data);
+  }
   while (pos) {
     int mb_len;
 
@@ -7675,6 +7683,14 @@ static size_t my_well_formed_len_utf8mb4(const CHARSET_INFO *cs, const char *b,
                                          int *error) {
   const char *b_start = b;
   *error = 0;
+  // Fast path as long as we see ASCII characters only.
+  while (pos >= 8 && e - b >= 8) {
+    uint64_t data;
+    memcpy(&data, b, sizeof(data));
+    if (data & 0x8080808080808080ULL) break;
+    b += sizeof(data);
+    pos -= sizeof(data);
+  }
   while (pos) {
     int mb_len;
 
@@ -419,4 +419,31 @@ static void MY_ATTRIBUTE((unused))
 }
 // BENCHMARK(BM_StdStableSortIntIntIntInt)
 
+static void BM_RadixSort(size_t num_iterations) {
+  StopBenchmarkTiming();
+  FileSortBMHelper helper;
+  std::vector<uchar *> buffer(helper.num_records);
+  for (size_t ix = 0; ix < num_iterations; ++ix) {
+    std::vector<uchar *> keys = helper.GetKeys();
+    StartBenchmarkTiming();
+    radixsort_for_str_ptr(keys.data(), keys.size(), helper.record_size,
+                          buffer.data());
+    StopBenchmarkTiming();
+  }
+}
+BENCHMARK(BM_RadixSort)
+
+TEST(FileSortRadixTest, SameOrderAsStableSort) {
+  FileSortBMHelper helper;
+  std::vector<uchar *> expected = helper.GetKeys();
+  std::vector<uchar *> keys = helper.GetKeys();
+  std::vector<uchar *> buffer(keys.size());
+
+  std::stable_sort(expected.begin(), expected.end(),
+                   Mem_compare_memcmp(helper.record_size));
+  radixsort_for_str_ptr(keys.data(), keys.size(), helper.record_size,
+                        buffer.data());
+  EXPECT_EQ(expected, keys);
+}
+
 }  // namespace filesort_compare_unittest
@@ -0,0 +1,134 @@
+/* Copyright (c) 2021, Percona and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/* See http://code.google.com/p/googletest/wiki/Primer */
+
+// First include (the generated) my_config.h, to get correct platform defines.
+#include "my_config.h"
+
+#include <gtest/gtest.h>
+
+#include "storage/innobase/include/univ.i"
+#include "storage/innobase/include/ut0link_buf.h"
+#include "unittest/gunit/benchmark.h"
+
+namespace innodb_ut0link_buf_unittest {
+
+typedef Link_buf<uint64_t> Test_link_buf;
+
+/** Capacity used by the tests, must be a power of two. */
+static const size_t capacity = 1024;
+
+/* test that the tail follows links added out of order */
+TEST(ut0link_buf, advance_tail) {
+  Test_link_buf buf(capacity);
+
+  EXPECT_EQ(0U, buf.tail());
+  EXPECT_EQ(capacity, buf.capacity());
+
+  buf.add_link(4, 8);
+  EXPECT_FALSE(buf.advance_tail());
+  EXPECT_EQ(0U, buf.tail());
+
+  buf.add_link(0, 4);
+  EXPECT_TRUE(buf.advance_tail());
+  EXPECT_EQ(8U, buf.tail());
+
+  buf.add_link_advance_tail(8, 16);
+  EXPECT_EQ(16U, buf.tail());
+
+  EXPECT_TRUE(buf.has_space(16 + capacity - 1));
+  EXPECT_FALSE(buf.has_space(16 + capacity));
+
+  buf.validate_no_links();
+}
+
+/* test links added out of order while they wrap around the ring buffer;
+the step does not divide the capacity, so links start and end on both
+sides of the end of the slot array */
+TEST(ut0link_buf, wrap_around) {
+  Test_link_buf buf(capacity);
+
+  uint64_t position = 0;
+  for (size_t i = 0; position < 3 * capacity; ++i) {
+    ASSERT_TRUE(buf.has_space(position + 6));
+
+    if (i % 2 == 0) {
+      /* The later link is followed by advance_tail() */
+      buf.add_link(position + 3, position + 6);
+      buf.add_link_advance_tail(position, position + 3);
+      EXPECT_EQ(position + 3, buf.tail());
+    } else {
+      /* The later link is stored by add_link_advance_tail(), which
+      cannot advance the tail past the missing earlier link */
+      buf.add_link_advance_tail(position + 3, position + 6);
+      EXPECT_EQ(position, buf.tail());
+      buf.add_link(position, position + 3);
+    }
+
+    EXPECT_TRUE(buf.advance_tail());
+    position += 6;
+    EXPECT_EQ(position, buf.tail());
+  }
+
+  buf.validate_no_links();
+}
+
+/* Links added in order, as by a single mtr committing at a time. */
+static void BM_LINK_BUF_IN_ORDER(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Test_link_buf buf(capacity);
+
+  StartBenchmarkTiming();
+  uint64_t position = 0;
+  for (size_t n = 0; n < num_iterations; n++) {
+    buf.add_link_advance_tail(position, position + 64);
+    position += 64;
+  }
+  StopBenchmarkTiming();
+
+  EXPECT_EQ(position, buf.tail());
+}
+BENCHMARK(BM_LINK_BUF_IN_ORDER)
+
+/* Pairs of links added in reverse order, so that every second
+advance_tail() has to follow two links. */
+static void BM_LINK_BUF_OUT_OF_ORDER(size_t num_iterations) {
+  StopBenchmarkTiming();
+  Test_link_buf buf(capacity);
+
+  StartBenchmarkTiming();
+  uint64_t position = 0;
+  for (size_t n = 0; n < num_iterations; n++) {
+    buf.add_link(position + 64, position + 128);
+    buf.advance_tail();
+    buf.add_link(position, position + 64);
+    buf.advance_tail();
+    position += 128;
+  }
+  StopBenchmarkTiming();
+
+  EXPECT_EQ(position, buf.tail());
+}
+BENCHMARK(BM_LINK_BUF_OUT_OF_ORDER)
+
+}  // namespace innodb_ut0link_buf_unittest
@@ -517,6 +517,32 @@ TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4) {
   ASSERT_EQ(1, error);
 }
 
+TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4Ascii) {
+  const char ascii_src[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  const char *end = ascii_src + 36;
+  int error;
+
+  /* ASCII runs, stopping on a character count inside a run */
+  EXPECT_EQ(36U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, end, 100, &error));
+  ASSERT_EQ(0, error);
+  EXPECT_EQ(11U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, end, 11, &error));
+  ASSERT_EQ(0, error);
+
+  /* multi-byte and illegal characters after and inside a run */
+  char mixed_src[24] = "abcdefghij\xc3\xa9klmnop";
+  EXPECT_EQ(18U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, mixed_src, mixed_src + 18, 17,
+                     &error));
+  ASSERT_EQ(0, error);
+  mixed_src[5] = '\xff';
+  EXPECT_EQ(5U, system_charset_info->cset->well_formed_len(
+                    system_charset_info, mixed_src, mixed_src + 18, 17,
+                    &error));
+  ASSERT_EQ(1, error);
+}
+
 TEST_F(StringsUTF8mb4Test, MyIsmbcharUtf8mb4) {
   char utf8_src[8];
 